@@ -20,7 +20,11 @@
 
 #include <stdlib.h>
 #include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include "dspl.h"
+#include "dspl_internal.h"
 
 
 
@@ -53,6 +57,9 @@ Else \ref ERROR_CODE_GROUP "code error".
 then convolution of the vectors `a` and `b` returns polynomial product 
 coefficients.
 
+\note Output vector `c` can be the same as `a` or `b` vector. In this case
+convolution is calculated in place without additional memory allocation.
+
 Example:
 \code{.cpp}
   double ar[3] = {1.0, 2.0, 3.0};
@@ -83,37 +90,15 @@ cr[5] =  12.0
 *******************************************************************************/
 int DSPL_API conv(double* a, int na, double* b, int nb, double* c)
 {
-  int k;
-  int n;
-
-  double *t;
-  size_t bufsize;
-
   if(!a || !b || !c)
     return ERROR_PTR;
   if(na < 1 || nb < 1)
     return ERROR_SIZE;
 
-
-  bufsize = (na + nb - 1) * sizeof(double);
-
-  if((a != c) && (b != c))
-    t = c;
-  else
-    t = (double*)malloc(bufsize);
-
-  memset(t, 0, bufsize);
-
-  for(k = 0; k < na; k++)
-    for(n = 0; n < nb; n++)
-      t[k+n] += a[k]*b[n];
-
-  if(t!=c)
-  {
-    memcpy(c, t, bufsize);
-    free(t);
-  }
-  return RES_OK;
+  /* convolution is commutative, kernel expects the shortest vector as `b` */
+  if(na < nb)
+    return conv_krn(b, nb, a, na, c);
+  return conv_krn(a, na, b, nb, c);
 }
 
 
@@ -150,6 +135,9 @@ Else \ref ERROR_CODE_GROUP "code error".
 then convolution of the vectors `a` and `b` returns polynomial product 
 coefficients.
 
+\note Output vector `c` can be the same as `a` or `b` vector. In this case
+convolution is calculated in place without additional memory allocation.
+
 Example:
 \code{.cpp}
   complex_t ac[3] = {{0.0, 1.0}, {1.0, 1.0}, {2.0, 2.0}};
@@ -181,42 +169,15 @@ cc[5] =   0.0+24.0j
 int DSPL_API conv_cmplx(complex_t* a, int na, complex_t* b,
                         int nb, complex_t* c)
 {
-  int k;
-  int n;
-
-  complex_t *t;
-  size_t bufsize;
-
   if(!a || !b || !c)
     return ERROR_PTR;
   if(na < 1 || nb < 1)
     return ERROR_SIZE;
 
-  bufsize = (na + nb - 1) * sizeof(complex_t);
-
-  if((a != c) && (b != c))
-    t = c;
-  else
-    t = (complex_t*)malloc(bufsize);
-
-  memset(t, 0, bufsize);
-
-  for(k = 0; k < na; k++)
-  {
-    for(n = 0; n < nb; n++)
-          {
-      RE(t[k+n]) += CMRE(a[k], b[n]);
-      IM(t[k+n]) += CMIM(a[k], b[n]);
-    }
-  }
-
-  if(t!=c)
-  {
-    memcpy(c, t, bufsize);
-    free(t);
-  }
-
-  return RES_OK;
+  /* convolution is commutative, kernel expects the shortest vector as `b` */
+  if(na < nb)
+    return conv_cmplx_krn(b, nb, a, na, c);
+  return conv_cmplx_krn(a, na, b, nb, c);
 }
 
 
@@ -371,6 +332,10 @@ The output convolution is a vector `c` with length equal to  `na + nb - 1`.
 \return `RES_OK` if convolution is calculated successfully. /n
 Else \ref ERROR_CODE_GROUP "code error".  /n /n
 
+\note Overlap-save segments are independent after the kernel spectrum is 
+calculated. If the library is built with OpenMP support, segments are 
+distributed between threads, each thread uses own FFT scratch buffers. /n /n
+
 Example:
 \include conv_fft_cmplx_test.c
 
@@ -404,11 +369,11 @@ int DSPL_API conv_fft_cmplx(complex_t* a, int na,   complex_t* b, int nb,
                             fft_t* pfft,  int nfft, complex_t* c)
 {
   
-  int La, Lb, Lc, Nz, n, p0, p1, ind, err;
+  int La, Lb, Lc, Nz, nseg, err;
   complex_t *pa, *pb;
-  complex_t *pt, *pA, *pB, *pC;
+  complex_t *pB = NULL;
   
-  if(!a || !b || !c)
+  if(!a || !b || !c || !pfft)
     return ERROR_PTR;
   if(na < 1 || nb < 1)
     return ERROR_SIZE;
@@ -434,80 +399,131 @@ int DSPL_API conv_fft_cmplx(complex_t* a, int na,   complex_t* b, int nb,
   if(Nz <= 0)
     return ERROR_FFT_SIZE;
 
-  pt = (complex_t*)malloc(nfft*sizeof(complex_t));
-  pB = (complex_t*)malloc(nfft*sizeof(complex_t));  
-  pA = (complex_t*)malloc(nfft*sizeof(complex_t));  
-  pC = (complex_t*)malloc(nfft*sizeof(complex_t));
+  pB = (complex_t*)malloc(nfft*sizeof(complex_t));
+  if(!pB)
+    return ERROR_MALLOC;
 
-  memset(pt,    0,  nfft*sizeof(complex_t));
-  memcpy(pt+Nz, pb, Lb*sizeof(complex_t));
+  /* kernel spectrum. fft_cmplx copies input before processing,
+     so it can be calculated in place */
+  memset(pB,    0,  nfft*sizeof(complex_t));
+  memcpy(pB+Nz, pb, Lb*sizeof(complex_t));
 
-  err = fft_cmplx(pt, nfft, pfft, pB);
+  err = fft_cmplx(pB, nfft, pfft, pB);
   if(err != RES_OK)
     goto exit_label;
 
-  p0 = -Lb;
-  p1 = p0 + nfft;
-  ind = 0;
-  while(ind < Lc)
+  /* overlap-save segments are independent and processed in parallel. 
+     Each thread keeps own FFT scratch buffers, twiddles are shared. */
+  nseg = (Lc + Nz - 1) / Nz;
+
+#ifdef _OPENMP
+  #pragma omp parallel if(nseg >= DSPL_OMP_MIN_BLOCKS)
+#endif
   {
-    if(p0 >=0)
-    {
-      if(p1 < La)
-        err = fft_cmplx(pa + p0, nfft, pfft, pA);
-      else
-      {
-        memset(pt, 0, nfft*sizeof(complex_t));
-        memcpy(pt, pa+p0, (nfft+La-p1)*sizeof(complex_t));
-        err = fft_cmplx(pt, nfft, pfft, pA);
-      }
-    }
-    else
+    fft_t      wfft;
+    complex_t *pt = NULL;
+    complex_t *pA = NULL;
+    int s, werr = RES_OK;
+
+    wfft    = *pfft;
+    wfft.t0 = (complex_t*)malloc(nfft*sizeof(complex_t));
+    wfft.t1 = (complex_t*)malloc(nfft*sizeof(complex_t));
+    pt      = (complex_t*)malloc(nfft*sizeof(complex_t));
+    pA      = (complex_t*)malloc(nfft*sizeof(complex_t));
+    if(!wfft.t0 || !wfft.t1 || !pt || !pA)
+      werr = ERROR_MALLOC;
+
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for(s = 0; s < nseg; s++)
     {
-      memset(pt, 0, nfft*sizeof(complex_t));
-      if(p1 < La)        
-        memcpy(pt - p0, pa, (nfft+p0)*sizeof(complex_t));
-      else
-        memcpy(pt - p0, pa, La * sizeof(complex_t));
-      err = fft_cmplx(pt, nfft, pfft, pA);
+      if(werr == RES_OK)
+        werr = conv_fft_cmplx_seg(pa, La, pB, Lb, &wfft, nfft, 
+                                  s*Nz, Lc, pt, pA, c);
     }
-    
-    if(err != RES_OK)
-      goto exit_label;
 
-    for(n = 0; n < nfft; n++)
+    if(werr != RES_OK)
     {
-      RE(pC[n]) = CMRE(pA[n], pB[n]);
-      IM(pC[n]) = CMIM(pA[n], pB[n]);
+#ifdef _OPENMP
+      #pragma omp critical
+#endif
+      err = werr;
     }
 
-
-    if(ind+nfft < Lc)
-      err = ifft_cmplx(pC, nfft, pfft, c+ind);
-    else
-    {
-      err = ifft_cmplx(pC, nfft, pfft, pt);
-      memcpy(c+ind, pt, (Lc-ind)*sizeof(complex_t));
-    }
-    if(err != RES_OK)
-      goto exit_label;
-    
-    p0  += Nz;
-    p1  += Nz;
-    ind += Nz;
+    if(wfft.t0) free(wfft.t0);
+    if(wfft.t1) free(wfft.t1);
+    if(pt) free(pt);
+    if(pA) free(pA);
   }
  
 exit_label: 
-  if(pt) free(pt);
   if(pB) free(pB);
-  if(pA) free(pA);
-  if(pC) free(pC);
   
   return err;
 }
 
 
 
+
+/******************************************************************************
+Overlap-save FFT convolution segment.
+Function calculates `nfft - nb` output samples of the convolution starting 
+from `ind` and writes them directly to `c + ind`. 
+`B` is the kernel spectrum, kernel is placed to the end of the FFT frame.
+`pt` and `pA` are scratch buffers size `nfft`, `pfft` must be created for 
+the `nfft` size and must not be shared with other threads.
+*******************************************************************************/
+int conv_fft_cmplx_seg(complex_t* a, int na, complex_t* B, int nb,
+                       fft_t* pfft, int nfft, int ind, int nc,
+                       complex_t* pt, complex_t* pA, complex_t* c)
+{
+  int p0, p1, i0, i1, n, nout, err;
+  double norm;
+
+  p0 = ind - nb;
+  p1 = p0 + nfft;
+
+  if(p0 >= 0 && p1 <= na)
+    err = fft_cmplx(a + p0, nfft, pfft, pA);
+  else
+  {
+    i0 = p0 > 0  ? p0 : 0;
+    i1 = p1 < na ? p1 : na;
+    memset(pt, 0, nfft*sizeof(complex_t));
+    if(i1 > i0)
+      memcpy(pt + i0 - p0, a + i0, (i1 - i0)*sizeof(complex_t));
+    err = fft_cmplx(pt, nfft, pfft, pA);
+  }
+  if(err != RES_OK)
+    return err;
+
+  /* spectrum product conjugated for the inverse FFT */
+  for(n = 0; n < nfft; n++)
+  {
+    RE(pfft->t1[n]) =  CMRE(pA[n], B[n]);
+    IM(pfft->t1[n]) = -CMIM(pA[n], B[n]);
+  }
+
+  err = fft_krn(pfft->t1, pfft->t0, pfft, nfft, 0);
+  if(err != RES_OK)
+    return err;
+
+  nout = nfft - nb;
+  if(ind + nout > nc)
+    nout = nc - ind;
+
+  norm = 1.0 / (double)nfft;
+  for(n = 0; n < nout; n++)
+  {
+    RE(c[ind+n]) =  RE(pfft->t0[n]) * norm;
+    IM(c[ind+n]) = -IM(pfft->t0[n]) * norm;
+  }
+  return RES_OK;
+}
+
+
+
 /*******************************************************************************
 \ingroup FILTER_CONV_GROUP
 \fn int filter_iir(double* b, double* a, int ord, double* x, int n, double* y)
@@ -518,7 +534,7 @@ contains real coefficients of the transfer function \f$H(z)\f$
  numerator and denominator:
 \f[
   H(z) = \frac{\sum_{n = 0}^{N} b_n  z^{-n}}
-  {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-n}},
+  {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-m}},
 \f]
 here \f$a_0\f$ cannot be equals zeros, \f$N=M=\f$`ord`.
 
@@ -578,9 +594,7 @@ int DSPL_API filter_iir(double* b, double* a, int ord,
 {
   double* buf = NULL;
   double* an  = NULL;
-  double  u;
   int   k;
-  int   m;
   int   count;
 
   if(!b || !x || !y)
@@ -592,36 +606,1601 @@ int DSPL_API filter_iir(double* b, double* a, int ord,
   if(a && a[0]==0.0)
     return ERROR_FILTER_A0;
 
+  /* FIR filter, linear phase impulse response symmetry is used */
+  if(!a)
+    return filter_fir_sym(b, ord+1, DSPL_FIR_AUTO, NULL, x, n, y);
+
   count = ord + 1;
-  buf = (double*) malloc(count*sizeof(double));
-  an =  (double*) malloc(count*sizeof(double));
+  buf = (double*) malloc(2*count*sizeof(double));
+  if(!buf)
+    return ERROR_MALLOC;
+  an = buf + count;
 
   memset(buf, 0, count*sizeof(double));
 
+  for(k = 0; k < count; k++)
+    an[k] = a[k] / a[0];
+
+  filter_iir_krn(b, an, ord, buf, x, n, y);
+
+  free(buf);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_cmplx(double* b, double* a, int ord,
+                         complex_t* x, int n, complex_t* y)
+\brief Real IIR filtration of the complex signal
+
+Function calculates real IIR filter output for complex signal.
+Transfer function is the same as for \ref filter_iir function.
+Real and imaginary parts of the input signal are filtered in one pass
+with the common complex delay line, so there is no need to split signal to
+real and imaginary parts and call \ref filter_iir twice.
+
+\param[in]  b     Pointer to the vector \f$b\f$ of IIR filter
+                  transfer function numerator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the vector \f$a\f$ of IIR filter
+                  transfer function denominator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  This pointer can be `NULL` if filter is FIR. /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in]  x     Pointer to the complex input signal vector. /n
+                  Vector size is `[n x 1]`. /n /n
+
+\param[in]  n     Size of the input signal vector `x`. /n /n
+
+\param[out] y     Pointer to the complex IIR filter output vector. /n
+                  Vector size is `[n x  1]`. /n
+                  Memory must be allocated. /n
+                  Vector `y` can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_cmplx(double* b, double* a, int ord,
+                              complex_t* x, int n, complex_t* y)
+{
+  complex_t* buf = NULL;
+  double* an = NULL;
+  int k;
+  int count;
+
+  if(!b || !x || !y)
+    return  ERROR_PTR;
+
+  if(ord < 1 || n < 1)
+      return ERROR_SIZE;
+
+  if(a && a[0]==0.0)
+    return ERROR_FILTER_A0;
+
+  count = ord + 1;
+  /* complex delay line and normalized denominator in one buffer */
+  buf = (complex_t*) malloc(ord*sizeof(complex_t) + count*sizeof(double));
+  if(!buf)
+    return ERROR_MALLOC;
+  an = (double*)(buf + ord);
+
+  memset(buf, 0, ord*sizeof(complex_t));
+
   if(!a)
+  {
     memset(an, 0, count*sizeof(double));
+    an[0] = 1.0;
+  }
   else
     for(k = 0; k < count; k++)
       an[k] = a[k] / a[0];
 
-  for(k = 0; k < n; k++)
+  filter_iir_cmplx_krn(b, an, ord, buf, x, n, y);
+
+  free(buf);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_cmplx_coeff(complex_t* b, complex_t* a, int ord,
+                               complex_t* x, int n, complex_t* y)
+\brief Complex IIR filtration
+
+Function calculates output of the IIR filter with complex transfer function
+coefficients (for example analytic or frequency shifted filters)
+for complex input signal:
+\f[
+  H(z) = \frac{\sum_{n = 0}^{N} b_n  z^{-n}}
+  {1+{\frac{1}{a_0}}\sum_{m = 1}^{M} a_m  z^{-m}},
+\f]
+here \f$a_0\f$ cannot be equals zeros, \f$N=M=\f$`ord`.
+
+\param[in]  b     Pointer to the vector \f$b\f$ of IIR filter
+                  transfer function complex numerator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the vector \f$a\f$ of IIR filter
+                  transfer function complex denominator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  This pointer can be `NULL` if filter is FIR. /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in]  x     Pointer to the complex input signal vector. /n
+                  Vector size is `[n x 1]`. /n /n
+
+\param[in]  n     Size of the input signal vector `x`. /n /n
+
+\param[out] y     Pointer to the complex IIR filter output vector. /n
+                  Vector size is `[n x  1]`. /n
+                  Memory must be allocated. /n
+                  Vector `y` can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_cmplx_coeff(complex_t* b, complex_t* a, int ord,
+                                    complex_t* x, int n, complex_t* y)
+{
+  complex_t* buf = NULL;
+  complex_t* an  = NULL;
+  double d;
+  int k;
+  int count;
+
+  if(!b || !x || !y)
+    return  ERROR_PTR;
+
+  if(ord < 1 || n < 1)
+      return ERROR_SIZE;
+
+  if(a && RE(a[0]) == 0.0 && IM(a[0]) == 0.0)
+    return ERROR_FILTER_A0;
+
+  count = ord + 1;
+  buf = (complex_t*) malloc(2*count*sizeof(complex_t));
+  if(!buf)
+    return ERROR_MALLOC;
+  an = buf + count;
+
+  memset(buf, 0, count*sizeof(complex_t));
+
+  if(!a)
+  {
+    memset(an, 0, count*sizeof(complex_t));
+    RE(an[0]) = 1.0;
+  }
+  else
+  {
+    d = 1.0 / ABSSQR(a[0]);
+    for(k = 0; k < count; k++)
+    {
+      RE(an[k]) = CMCONJRE(a[k], a[0]) * d;
+      IM(an[k]) = CMCONJIM(a[k], a[0]) * d;
+    }
+  }
+
+  filter_iir_cmplx_coeff_krn(b, an, ord, buf, x, n, y);
+
+  free(buf);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_create(filter_iir_t* pf, double* b, double* a, int ord)
+\brief Create real IIR filter object for stream processing
+
+Function fills `filter_iir_t` structure by the IIR filter transfer function
+coefficients and clears the filter delay line. Filter object keeps the
+delay line between \ref filter_iir_process calls, so the signal can be
+filtered by blocks without transients on the block boundaries.
+Transfer function is the same as for \ref filter_iir function.
+
+\param[in,out] pf  Pointer to the `filter_iir_t` structure. /n
+                    Structure must be cleared before the first call
+                    (for example by `memset(pf, 0, sizeof(filter_iir_t))`).
+                    Allocated memory must be released by
+                    \ref filter_iir_free function. /n /n
+
+\param[in]  b      Pointer to the vector \f$b\f$ of IIR filter
+                    transfer function numerator coefficients. /n
+                    Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a      Pointer to the vector \f$a\f$ of IIR filter
+                    transfer function denominator coefficients. /n
+                    Vector size is `[ord + 1 x 1]`. /n
+                    This pointer can be `NULL` if filter is FIR. /n /n
+
+\param[in]  ord    Filter order. /n /n
+
+\return
+`RES_OK` if filter object is created successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_create(filter_iir_t* pf, double* b, double* a, int ord)
+{
+  int k;
+
+  if(!pf || !b)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_SIZE;
+  if(a && a[0] == 0.0)
+    return ERROR_FILTER_A0;
+
+  if(pf->ord != ord)
+  {
+    /* b, a and delay line z are placed in one memory block */
+    pf->b = pf->b ? (double*) realloc(pf->b, (3*ord+2)*sizeof(double)):
+                    (double*) malloc(        (3*ord+2)*sizeof(double));
+    if(!pf->b)
+    {
+      memset(pf, 0, sizeof(filter_iir_t));
+      return ERROR_MALLOC;
+    }
+    pf->a = pf->b + ord + 1;
+    pf->z = pf->a + ord + 1;
+    pf->ord = ord;
+  }
+
+  memcpy(pf->b, b, (ord+1)*sizeof(double));
+  if(!a)
+  {
+    memset(pf->a, 0, (ord+1)*sizeof(double));
+    pf->a[0] = 1.0;
+  }
+  else
+    for(k = 0; k < ord+1; k++)
+      pf->a[k] = a[k] / a[0];
+
+  memset(pf->z, 0, ord*sizeof(double));
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn void filter_iir_free(filter_iir_t* pf)
+\brief Free IIR filter object memory
+
+\param[in,out] pf  Pointer to the `filter_iir_t` structure. /n
+                    Structure is cleared after memory releasing. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API filter_iir_free(filter_iir_t* pf)
+{
+  if(!pf)
+    return;
+  if(pf->b)
+    free(pf->b);
+  memset(pf, 0, sizeof(filter_iir_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_init(filter_iir_t* pf, double x0)
+\brief Set IIR filter object delay line to the steady state
+
+Function sets filter delay line to the steady state for the constant
+input signal \f$x(n) = x_0\f$, so the step input with level `x0`
+passes through the filter without transient. If `x0 = 0` then the
+delay line is cleared.
+
+\param[in,out] pf  Pointer to the `filter_iir_t` structure
+                    created by \ref filter_iir_create function. /n /n
+
+\param[in]  x0     Constant input signal level. /n /n
+
+\return
+`RES_OK` if filter delay line is set successfully. /n
+`ERROR_DIV_ZERO` if filter has a pole \f$z = 1\f$ and
+steady state does not exist. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_init(filter_iir_t* pf, double x0)
+{
+  double sa, sb, y0;
+  int k;
+
+  if(!pf || !pf->b)
+    return ERROR_PTR;
+
+  if(x0 == 0.0)
   {
-    for(m = ord; m > 0; m--)
-      buf[m] = buf[m-1];
-    u = 0.0;
-    for(m = ord; m > 0; m--)
-      u += buf[m]*an[m];
+    memset(pf->z, 0, pf->ord*sizeof(double));
+    return RES_OK;
+  }
 
-    buf[0] = x[k] - u;
-    y[k] = 0.0;
-    for(m = 0; m < count; m++)
-      y[k] += buf[m] * b[m];
+  /* steady state output is y0 = x0 * H(1) */
+  sa = sb = 0.0;
+  for(k = 0; k < pf->ord+1; k++)
+  {
+    sa += pf->a[k];
+    sb += pf->b[k];
   }
+  if(sa == 0.0)
+    return ERROR_DIV_ZERO;
+  y0 = x0 * sb / sa;
+
+  /* transposed direct form II delay line for constant input and output */
+  pf->z[pf->ord-1] = pf->b[pf->ord] * x0 - pf->a[pf->ord] * y0;
+  for(k = pf->ord-2; k >= 0; k--)
+    pf->z[k] = pf->z[k+1] + pf->b[k+1] * x0 - pf->a[k+1] * y0;
 
-  if(buf)
-    free(buf);
-  if(an)
-    free(an);
   return RES_OK;
 }
 
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_process(filter_iir_t* pf, double* x, int n, double* y)
+\brief Real IIR filtration of the signal block by IIR filter object
+
+Function filters input block `x` by the filter object `pf`. Filter delay
+line is kept in the filter object, so the next call continues filtration
+of the signal stream. Function does not allocate memory.
+
+\param[in,out] pf  Pointer to the `filter_iir_t` structure
+                    created by \ref filter_iir_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                    Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Size of the input block. /n /n
+
+\param[out] y      Pointer to the filter output block. /n
+                    Vector size is `[n x 1]`. /n
+                    Pointer can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_process(filter_iir_t* pf, double* x, int n, double* y)
+{
+  if(!pf || !pf->b || !x || !y)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  return filter_iir_krn(pf->b, pf->a, pf->ord, pf->z, x, n, y);
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_fir_sym(double* h, int nh, int sym, double* z,
+                       double* x, int n, double* y)
+\brief Linear phase FIR filtration with symmetric impulse response
+
+Function calculates output of the FIR filter
+\f[
+  y(k) = \sum_{i = 0}^{n_h-1} h(i)  x(k-i).
+\f]
+If impulse response is symmetric \f$h(i) = h(n_h - 1 - i)\f$ or
+antisymmetric \f$h(i) = -h(n_h - 1 - i)\f$ (linear phase filters designed
+by \ref fir_linphase function), then the mirrored input samples are
+added (subtracted) before multiplication:
+\f[
+  y(k) = \sum_{i = 0}^{n_h/2-1} h(i) \left(x(k-i) \pm x(k-n_h+1+i)\right),
+\f]
+so the number of multiplications is halved.
+Outputs are calculated by blocks, so the loops are vectorized.
+
+\param[in]  h     Pointer to the FIR filter impulse response. /n
+                  Vector size is `[nh x 1]`. /n /n
+
+\param[in]  nh    Impulse response size. /n /n
+
+\param[in]  sym   Impulse response symmetry type: /n
+\verbatim
+DSPL_FIR_AUTO           - symmetry is detected by the function
+                          (h(i) and h(nh-1-i) must be exactly equal
+                          or opposite)
+DSPL_FIR_SYMMETRIC      - impulse response is symmetric
+DSPL_FIR_ANTISYMMETRIC  - impulse response is antisymmetric
+DSPL_FIR_GENERIC        - impulse response is not symmetric
+\endverbatim
+/n
+
+\param[in,out] z  Pointer to the filter delay line
+                  (`nh-1` previous input samples). /n
+                  Vector size is `[nh-1 x 1]`. /n
+                  Delay line is updated, so the next function call
+                  continues the signal stream filtration. /n
+                  Pointer can be `NULL`, then filter starts from the
+                  zero state. /n /n
+
+\param[in]  x     Pointer to the input signal vector. /n
+                  Vector size is `[n x 1]`. /n /n
+
+\param[in]  n     Size of the input signal vector `x`. /n /n
+
+\param[out] y     Pointer to the filter output vector. /n
+                  Vector size is `[n x 1]`. /n
+                  Pointer can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_fir_sym(double* h, int nh, int sym, double* z,
+                            double* x, int n, double* y)
+{
+  double *t = NULL;
+  int k, nz, nt;
+
+  if(!h || !x || !y)
+    return ERROR_PTR;
+  if(nh < 1 || n < 1)
+    return ERROR_SIZE;
+
+  /* symmetry is detected by the exact equality, so the nearly symmetric
+     impulse response is not folded */
+  if(sym == DSPL_FIR_AUTO)
+  {
+    sym = DSPL_FIR_SYMMETRIC;
+    for(k = 0; k < nh/2 && sym == DSPL_FIR_SYMMETRIC; k++)
+      if(h[k] != h[nh-1-k])
+        sym = DSPL_FIR_ANTISYMMETRIC;
+    for(k = 0; k < (nh+1)/2 && sym == DSPL_FIR_ANTISYMMETRIC; k++)
+      if(h[k] != -h[nh-1-k])
+        sym = DSPL_FIR_GENERIC;
+  }
+  if(sym != DSPL_FIR_SYMMETRIC && sym != DSPL_FIR_ANTISYMMETRIC &&
+     sym != DSPL_FIR_GENERIC)
+    return ERROR_FIR_SYM;
+
+  nz = nh - 1;
+  /* first nz outputs use the delay line,
+     t = [z, x(0) ... x(nt-1)] */
+  nt = n < nz ? n : nz;
+  if(nz)
+  {
+    t = (double*) malloc((nz + nt) * sizeof(double));
+    if(!t)
+      return ERROR_MALLOC;
+    if(z)
+      memcpy(t, z, nz * sizeof(double));
+    else
+      memset(t, 0, nz * sizeof(double));
+    memcpy(t + nz, x, nt * sizeof(double));
+
+    /* new delay line before x can be overwritten by y */
+    if(z)
+    {
+      if(n < nz)
+        memmove(z, z + n, (nz - n) * sizeof(double));
+      memcpy(z + nz - nt, x + n - nt, nt * sizeof(double));
+    }
+  }
+
+  /* outputs which use input samples only, processed from the end
+     so the output can overwrite the input */
+  if(n > nz)
+    fir_sym_krn(h, nh, sym, x, n - nz, y + nz);
+  if(nz)
+  {
+    fir_sym_krn(h, nh, sym, t, nt, y);
+    free(t);
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_sos(double* sos, int nsec, double* z,
+                   double* x, int n, double* y)
+\brief Real IIR filtration by the cascade of second order sections
+
+Function calculates output of the IIR filter which is presented as
+a cascade of `nsec` second order sections (see \ref iir_sos function).
+Each section is calculated in the transposed direct form II.
+Input signal is processed by blocks and each block passes all sections
+one by one, so the section delay line and coefficients are kept
+in registers during the block processing.
+
+\param[in]  sos   Pointer to the second order sections coefficients. /n
+                  Coefficients \f$b_{0,k}, b_{1,k}, b_{2,k},
+                  a_{0,k}, a_{1,k}, a_{2,k}\f$ of the `k`-th section are
+                  `sos[6*k] ... sos[6*k+5]`. /n
+                  Vector size is `[6*nsec x 1]`. /n /n
+
+\param[in]  nsec  Number of second order sections. /n /n
+
+\param[in,out] z  Pointer to the sections delay line. /n
+                  Vector size is `[2*nsec x 1]`. /n
+                  Delay line is updated, so the next function call
+                  continues the signal stream filtration. /n
+                  Pointer can be `NULL`, then filter starts from the
+                  zero state. /n /n
+
+\param[in]  x     Pointer to the input signal vector. /n
+                  Vector size is `[n x 1]`. /n /n
+
+\param[in]  n     Size of the input signal vector `x`. /n /n
+
+\param[out] y     Pointer to the filter output vector. /n
+                  Vector size is `[n x 1]`. /n
+                  Pointer can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_sos(double* sos, int nsec, double* z,
+                        double* x, int n, double* y)
+{
+  double* zt = NULL;
+  int k, err;
+
+  if(!sos || !x || !y)
+    return ERROR_PTR;
+  if(nsec < 1 || n < 1)
+    return ERROR_SIZE;
+  for(k = 0; k < nsec; k++)
+    if(sos[6*k+3] == 0.0)
+      return ERROR_FILTER_A0;
+
+  if(!z)
+  {
+    zt = (double*) malloc(2 * nsec * sizeof(double));
+    if(!zt)
+      return ERROR_MALLOC;
+    memset(zt, 0, 2 * nsec * sizeof(double));
+  }
+
+  err = filter_sos_krn(sos, nsec, z ? z : zt, x, n, y);
+
+  if(zt)
+    free(zt);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_mch(double* b, double* a, int ord, double* z,
+                       double* x, int n, int nch, int flag, double* y)
+\brief Multichannel real IIR filtration
+
+Function filters `nch` channels of the real signal by the same IIR filter
+(transfer function is the same as for \ref filter_iir function).
+Channels are processed together: each recursion step is calculated for
+a group of channels by a loop over channels, which is vectorized by
+compiler (one SIMD lane per channel).
+Planar signals are processed by blocks of `DSPL_MCH_BLOCK` samples,
+which are transposed to the interleaved buffer, so the kernel loads
+channels with unit stride for both layouts.
+
+\param[in]  b     Pointer to the vector \f$b\f$ of IIR filter
+                  transfer function numerator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the vector \f$a\f$ of IIR filter
+                  transfer function denominator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  This pointer can be `NULL` if filter is FIR. /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in,out] z  Pointer to the channels delay line. /n
+                  Delay line element `m` of channel `c` is `z[m*nch + c]`,
+                  vector size is `[ord * nch x 1]`. /n
+                  Delay line is updated, so the next function call
+                  continues the signals filtration. /n
+                  Pointer can be `NULL`, then filter starts from the
+                  zero state. /n /n
+
+\param[in]  x     Pointer to the input signals. /n
+                  Vector size is `[n * nch x 1]`. /n /n
+
+\param[in]  n     Number of samples of each channel. /n /n
+
+\param[in]  nch   Number of channels. /n /n
+
+\param[in]  flag  Input and output signals layout: /n
+\verbatim
+DSPL_MCH_INTERLEAVED  sample k of channel c is x[k*nch + c]
+DSPL_MCH_PLANAR       sample k of channel c is x[c*n + k]
+\endverbatim
+
+\param[out] y     Pointer to the output signals. /n
+                  Vector size is `[n * nch x 1]`, layout is the same
+                  as for input `x`. /n
+                  Pointer can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_mch(double* b, double* a, int ord, double* z,
+                            double* x, int n, int nch, int flag, double* y)
+{
+  double t[DSPL_MCH_BLOCK * DSPL_MCH_LANES];
+  double* zt = NULL;
+  unsigned int csr;
+  int c, ng, k, len, blk, err = RES_OK;
+
+  if(!b || !x || !y)
+    return ERROR_PTR;
+  if(ord < 1 || n < 1 || nch < 1)
+    return ERROR_SIZE;
+  if(a && a[0] == 0.0)
+    return ERROR_FILTER_A0;
+  if(flag != DSPL_MCH_INTERLEAVED && flag != DSPL_MCH_PLANAR)
+    return ERROR_MCH_FLAG;
+
+  if(!z)
+  {
+    zt = (double*) malloc(ord * nch * sizeof(double));
+    if(!zt)
+      return ERROR_MALLOC;
+    memset(zt, 0, ord * nch * sizeof(double));
+  }
+
+  /* signal is processed by blocks of DSPL_MCH_BLOCK samples,
+     so the block rows are kept in cache while groups of DSPL_MCH_LANES
+     channels are processed */
+  blk = DSPL_MCH_BLOCK;
+  csr = dspl_ftz_enter();
+  for(k = 0; k < n; k += blk)
+  {
+    len = n - k < blk ? n - k : blk;
+    for(c = 0; c < nch; c += ng)
+    {
+      ng = nch - c < DSPL_MCH_LANES ? nch - c : DSPL_MCH_LANES;
+      if(flag == DSPL_MCH_INTERLEAVED)
+        err = filter_iir_mch_krn(b, a, ord, z ? z+c : zt+c, nch,
+                                 x+k*nch+c, nch, 1, y+k*nch+c, len, ng);
+      else
+      {
+        /* planar block is transposed to the contiguous buffer, so the
+           kernel loads channels group with unit stride */
+        filter_mch_transpose(x+c*n+k, n, ng, len, t, ng);
+        err = filter_iir_mch_krn(b, a, ord, z ? z+c : zt+c, nch,
+                                 t, ng, 1, t, len, ng);
+        filter_mch_transpose(t, ng, len, ng, y+c*n+k, n);
+      }
+      if(err != RES_OK)
+        goto exit_label;
+    }
+  }
+
+exit_label:
+  dspl_ftz_leave(csr);
+  if(zt)
+    free(zt);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_bank(double* b, double* a, int ord, double* z,
+                        double* x, int n, int nch, int flag, double* y)
+\brief Multichannel IIR filtration by the filter bank
+
+Function filters `nch` channels of the real signal, each channel is
+filtered by its own IIR (or FIR) filter of the order `ord`.
+Filter coefficients are stored as a matrix with the channels in columns:
+coefficient `m` of the channel `c` filter is `b[m*nch + c]`
+(the same layout as the channels delay line),
+so coefficients of the neighbouring channels are adjacent and
+recursion is vectorized across channels as in \ref filter_iir_mch.
+Filter bank coefficients in this layout are calculated by
+\ref iir_bank and \ref fir_linphase_bank functions.
+
+\param[in]  b     Pointer to the filters numerator coefficients matrix. /n
+                  Matrix size is `[(ord + 1) * nch x 1]`. /n /n
+
+\param[in]  a     Pointer to the filters denominator coefficients
+                  matrix. /n
+                  Matrix size is `[(ord + 1) * nch x 1]`. /n
+                  This pointer can be `NULL` if filters are FIR. /n /n
+
+\param[in]  ord   Filters order. /n /n
+
+\param[in,out] z  Pointer to the channels delay line. /n
+                  Delay line element `m` of channel `c` is `z[m*nch + c]`,
+                  vector size is `[ord * nch x 1]`. /n
+                  Pointer can be `NULL`, then filters start from the
+                  zero state. /n /n
+
+\param[in]  x     Pointer to the input signals. /n
+                  Vector size is `[n * nch x 1]`. /n /n
+
+\param[in]  n     Number of samples of each channel. /n /n
+
+\param[in]  nch   Number of channels. /n /n
+
+\param[in]  flag  Input and output signals layout
+                  (see \ref filter_iir_mch). /n /n
+
+\param[out] y     Pointer to the output signals. /n
+                  Vector size is `[n * nch x 1]`, layout is the same
+                  as for input `x`. /n
+                  Pointer can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_bank(double* b, double* a, int ord, double* z,
+                             double* x, int n, int nch, int flag, double* y)
+{
+  double t[DSPL_MCH_BLOCK * DSPL_MCH_LANES];
+  double* zt = NULL;
+  unsigned int csr;
+  int c, ng, k, len, blk, err = RES_OK;
+
+  if(!b || !x || !y)
+    return ERROR_PTR;
+  if(ord < 1 || n < 1 || nch < 1)
+    return ERROR_SIZE;
+  if(a)
+    for(c = 0; c < nch; c++)
+      if(a[c] == 0.0)
+        return ERROR_FILTER_A0;
+  if(flag != DSPL_MCH_INTERLEAVED && flag != DSPL_MCH_PLANAR)
+    return ERROR_MCH_FLAG;
+
+  if(!z)
+  {
+    zt = (double*) malloc(ord * nch * sizeof(double));
+    if(!zt)
+      return ERROR_MALLOC;
+    memset(zt, 0, ord * nch * sizeof(double));
+  }
+
+  blk = DSPL_MCH_BLOCK;
+  csr = dspl_ftz_enter();
+  for(k = 0; k < n; k += blk)
+  {
+    len = n - k < blk ? n - k : blk;
+    for(c = 0; c < nch; c += ng)
+    {
+      ng = nch - c < DSPL_MCH_LANES ? nch - c : DSPL_MCH_LANES;
+      if(flag == DSPL_MCH_INTERLEAVED)
+        err = filter_iir_bank_krn(b+c, a ? a+c : NULL, nch, ord,
+                                  z ? z+c : zt+c, nch,
+                                  x+k*nch+c, nch, 1, y+k*nch+c, len, ng);
+      else
+      {
+        filter_mch_transpose(x+c*n+k, n, ng, len, t, ng);
+        err = filter_iir_bank_krn(b+c, a ? a+c : NULL, nch, ord,
+                                  z ? z+c : zt+c, nch,
+                                  t, ng, 1, t, len, ng);
+        filter_mch_transpose(t, ng, len, ng, y+c*n+k, n);
+      }
+      if(err != RES_OK)
+        goto exit_label;
+    }
+  }
+
+exit_label:
+  dspl_ftz_leave(csr);
+  if(zt)
+    free(zt);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_iir_par(double* b, double* a, int ord, double* z,
+                       double* x, int n, double* y)
+\brief Block-parallel real IIR filtration of the long signal
+
+Function calculates the same output as \ref filter_iir function,
+but the long input signal is split into blocks which are filtered
+in parallel threads (OpenMP):
+
+1. Each block is filtered independently from the zero state.
+
+2. Initial state of each block is calculated serially by the state
+   propagation \f$ \mathbf{s}_{j+1} = \mathbf{s}^0_j + \mathbf{A}^L
+   \mathbf{s}_j \f$, here \f$ \mathbf{s}^0_j \f$ is the final
+   state of block `j` filtered from the zero state,
+   \f$ \mathbf{A} \f$ is the filter state transition matrix and
+   `L` is the block size.
+
+3. Zero input response of the initial state is added to each block
+   in parallel.
+
+Matrix \f$ \mathbf{A}^L \f$ is calculated by `L` steps of the zero
+input recursion from the unit vectors, so the output differs from the
+serial filtration by the rounding errors only.
+If the signal is too short, the library is built without OpenMP, or
+\f$ \mathbf{A}^L \f$ is not finite or not contracting
+(poles are too close to the unit circle for the block size `L`),
+then the signal is filtered serially.
+
+\param[in]  b     Pointer to the vector \f$b\f$ of IIR filter
+                  transfer function numerator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the vector \f$a\f$ of IIR filter
+                  transfer function denominator coefficients. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  This pointer can be `NULL` if filter is FIR. /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in,out] z  Pointer to the filter delay line
+                  (transposed direct form II). /n
+                  Vector size is `[ord x 1]`. /n
+                  Delay line is updated, so the next function call
+                  continues the signal filtration. /n
+                  Pointer can be `NULL`, then filter starts from the
+                  zero state. /n /n
+
+\param[in]  x     Pointer to the input signal vector. /n
+                  Vector size is `[n x 1]`. /n /n
+
+\param[in]  n     Size of the input signal vector `x`. /n /n
+
+\param[out] y     Pointer to the filter output vector. /n
+                  Vector size is `[n x 1]`. /n
+                  Pointer can be the same as `x`. /n /n
+
+\return
+`RES_OK` if filter output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_iir_par(double* b, double* a, int ord, double* z,
+                            double* x, int n, double* y)
+{
+  double *buf = NULL, *an, *s0, *s, *al;
+  int nb, len, j, k, m, ftz, err;
+
+  if(!b || !x || !y)
+    return ERROR_PTR;
+  if(ord < 1 || n < 1)
+    return ERROR_SIZE;
+  if(a && a[0] == 0.0)
+    return ERROR_FILTER_A0;
+
+  nb = 1;
+#ifdef _OPENMP
+  nb = omp_get_max_threads();
+#endif
+  if(nb > n / DSPL_IIR_PAR_BLOCK_MIN)
+    nb = n / DSPL_IIR_PAR_BLOCK_MIN;
+  if(nb < 2)
+    nb = 1;
+  len = (n + nb - 1) / nb;
+  nb  = (n + len - 1) / len;
+
+  /* an[ord+1], s0[nb*ord], s[(nb+1)*ord], al[ord*ord] */
+  buf = (double*) malloc((ord + 1 + (2*nb + 1)*ord + ord*ord) *
+                          sizeof(double));
+  if(!buf)
+    return ERROR_MALLOC;
+  an = buf;
+  s0 = an + ord + 1;
+  s  = s0 + nb * ord;
+  al = s  + (nb + 1) * ord;
+
+  if(!a)
+  {
+    memset(an, 0, (ord+1)*sizeof(double));
+    an[0] = 1.0;
+  }
+  else
+    for(k = 0; k < ord+1; k++)
+      an[k] = a[k] / a[0];
+
+  if(z)
+    memcpy(s, z, ord*sizeof(double));
+  else
+    memset(s, 0, ord*sizeof(double));
+
+  /* blocks state transition matrix A^L. If it cannot be calculated
+     accurately then the signal is filtered serially */
+  if(nb > 1 && filter_iir_state_pow(an, ord, len, al) != RES_OK)
+    nb = 1;
+
+  if(nb == 1)
+  {
+    err = filter_iir_krn(b, an, ord, s, x, n, y);
+    if(z)
+      memcpy(z, s, ord*sizeof(double));
+    goto exit_label;
+  }
+
+  /* blocks filtration from the zero state.
+     Worker threads use the calling thread denormals flush mode */
+  memset(s0, 0, nb*ord*sizeof(double));
+  ftz = dspl_ftz_get();
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif
+  {
+    int jb, prev = dspl_ftz_mode(ftz);
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for(jb = 0; jb < nb; jb++)
+      filter_iir_krn(b, an, ord, s0 + jb*ord, x + jb*len,
+                     (jb < nb-1) ? len : n - jb*len, y + jb*len);
+    dspl_ftz_mode(prev);
+  }
+
+  /* blocks initial states propagation */
+  err = RES_OK;
+  for(j = 0; j < nb-1; j++)
+  {
+    for(m = 0; m < ord; m++)
+    {
+      s[(j+1)*ord + m] = s0[j*ord + m];
+      for(k = 0; k < ord; k++)
+        s[(j+1)*ord + m] += al[m + k*ord] * s[j*ord + k];
+    }
+  }
+
+  /* zero input response correction */
+#ifdef _OPENMP
+  #pragma omp parallel
+#endif
+  {
+    int jb, prev = dspl_ftz_mode(ftz);
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for(jb = 0; jb < nb; jb++)
+      filter_iir_zir_krn(an, ord, s + jb*ord, y + jb*len,
+                         (jb < nb-1) ? len : n - jb*len);
+    dspl_ftz_mode(prev);
+  }
+
+  /* final state is the last block zero state filtration final state
+     plus the last block zero input response final state */
+  if(z)
+    for(m = 0; m < ord; m++)
+      z[m] = s0[(nb-1)*ord + m] + s[(nb-1)*ord + m];
+
+exit_label:
+  free(buf);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Real direct convolution kernel.
+Output-stationary loop: each output sample c[i] is accumulated in a local
+block and stored once. Interior outputs are calculated by blocks of
+DSPL_CONV_BLOCK samples, inner loop over the block is vectorized by compiler.
+Outputs are calculated from the last to the first one, so c[i] depends on
+a[k] and b[k] with k <= i only, and `c` can be the same as `a` or `b`.
+Vector `b` must be not longer than vector `a` (nb <= na).
+*******************************************************************************/
+int conv_krn(double* a, int na, double* b, int nb, double* c)
+{
+  double acc[DSPL_CONV_BLOCK];
+  double s, bn;
+  double *pa;
+  int i, j, n, n0, n1;
+
+  /* tail: i > na-1, not all taps are used */
+  for(i = na + nb - 2; i > na - 1; i--)
+  {
+    n0 = i - na + 1;
+    s = 0.0;
+    for(n = n0; n < nb; n++)
+      s += b[n] * a[i-n];
+    c[i] = s;
+  }
+
+  /* interior: all taps are used, register-blocked kernel */
+  i = na - DSPL_CONV_BLOCK;
+  while(i >= nb - 1)
+  {
+    for(j = 0; j < DSPL_CONV_BLOCK; j++)
+      acc[j] = 0.0;
+    for(n = 0; n < nb; n++)
+    {
+      bn = b[n];
+      pa = a + i - n;
+      for(j = 0; j < DSPL_CONV_BLOCK; j++)
+        acc[j] += bn * pa[j];
+    }
+    for(j = 0; j < DSPL_CONV_BLOCK; j++)
+      c[i+j] = acc[j];
+    i -= DSPL_CONV_BLOCK;
+  }
+
+  /* interior outputs which are not multiple of block size and head */
+  for(i = i + DSPL_CONV_BLOCK - 1; i >= 0; i--)
+  {
+    n1 = i < nb - 1 ? i : nb - 1;
+    s = 0.0;
+    for(n = 0; n <= n1; n++)
+      s += b[n] * a[i-n];
+    c[i] = s;
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Complex direct convolution kernel.
+The same as `conv_krn` for complex vectors. Vector `b` must be not longer 
+than vector `a` (nb <= na).
+*******************************************************************************/
+int conv_cmplx_krn(complex_t* a, int na, complex_t* b, int nb, complex_t* c)
+{
+  double accr[2*DSPL_CONV_BLOCK_CMPLX];
+  double acci[2*DSPL_CONV_BLOCK_CMPLX];
+  double sr, si, br, bi;
+  double *pa;
+  int i, j, n, n0, n1;
+
+  for(i = na + nb - 2; i > na - 1; i--)
+  {
+    n0 = i - na + 1;
+    sr = si = 0.0;
+    for(n = n0; n < nb; n++)
+    {
+      sr += CMRE(b[n], a[i-n]);
+      si += CMIM(b[n], a[i-n]);
+    }
+    RE(c[i]) = sr;
+    IM(c[i]) = si;
+  }
+
+  /* interior: complex vectors are processed as real interleaved arrays,
+     accr accumulates RE(b[n]) * a and acci accumulates IM(b[n]) * a */
+  i = na - DSPL_CONV_BLOCK_CMPLX;
+  while(i >= nb - 1)
+  {
+    for(j = 0; j < 2*DSPL_CONV_BLOCK_CMPLX; j++)
+      accr[j] = acci[j] = 0.0;
+    for(n = 0; n < nb; n++)
+    {
+      br = RE(b[n]);
+      bi = IM(b[n]);
+      pa = (double*)(a + i - n);
+      for(j = 0; j < 2*DSPL_CONV_BLOCK_CMPLX; j++)
+      {
+        accr[j] += br * pa[j];
+        acci[j] += bi * pa[j];
+      }
+    }
+    for(j = 0; j < DSPL_CONV_BLOCK_CMPLX; j++)
+    {
+      RE(c[i+j]) = accr[2*j]   - acci[2*j+1];
+      IM(c[i+j]) = accr[2*j+1] + acci[2*j];
+    }
+    i -= DSPL_CONV_BLOCK_CMPLX;
+  }
+
+  for(i = i + DSPL_CONV_BLOCK_CMPLX - 1; i >= 0; i--)
+  {
+    n1 = i < nb - 1 ? i : nb - 1;
+    sr = si = 0.0;
+    for(n = 0; n <= n1; n++)
+    {
+      sr += CMRE(b[n], a[i-n]);
+      si += CMIM(b[n], a[i-n]);
+    }
+    RE(c[i]) = sr;
+    IM(c[i]) = si;
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Real IIR filter kernel. Transposed direct form II.
+Denominator `a` must be normalized (a[0] = 1).
+Delay line `z` size is `ord`, it is updated for the next kernel call.
+Vector `y` can be the same as `x`.
+*******************************************************************************/
+int filter_iir_krn(double* b, double* a, int ord, double* z,
+                   double* x, int n, double* y)
+{
+  double xk, yk;
+  unsigned int csr;
+  int k, m;
+
+  csr = dspl_ftz_enter();
+  for(k = 0; k < n; k++)
+  {
+    xk = x[k];
+    yk = b[0] * xk + z[0];
+    for(m = 0; m < ord-1; m++)
+      z[m] = z[m+1] + b[m+1] * xk - a[m+1] * yk;
+    z[ord-1] = b[ord] * xk - a[ord] * yk;
+    y[k] = yk;
+  }
+  dspl_ftz_leave(csr);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Real IIR filter kernel for complex signal. Transposed direct form II.
+Denominator `a` must be normalized (a[0] = 1).
+Complex delay line `z` size is `ord`, it is updated for the next kernel call.
+Real and imaginary parts are filtered in one pass.
+Vector `y` can be the same as `x`.
+*******************************************************************************/
+int filter_iir_cmplx_krn(double* b, double* a, int ord, complex_t* z,
+                         complex_t* x, int n, complex_t* y)
+{
+  double xr, xi, yr, yi;
+  unsigned int csr;
+  int k, m;
+
+  csr = dspl_ftz_enter();
+  for(k = 0; k < n; k++)
+  {
+    xr = RE(x[k]);
+    xi = IM(x[k]);
+    yr = b[0] * xr + RE(z[0]);
+    yi = b[0] * xi + IM(z[0]);
+    for(m = 0; m < ord-1; m++)
+    {
+      RE(z[m]) = RE(z[m+1]) + b[m+1] * xr - a[m+1] * yr;
+      IM(z[m]) = IM(z[m+1]) + b[m+1] * xi - a[m+1] * yi;
+    }
+    RE(z[ord-1]) = b[ord] * xr - a[ord] * yr;
+    IM(z[ord-1]) = b[ord] * xi - a[ord] * yi;
+    RE(y[k]) = yr;
+    IM(y[k]) = yi;
+  }
+  dspl_ftz_leave(csr);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Complex IIR filter kernel for complex signal. Transposed direct form II.
+Denominator `a` must be normalized (a[0] = 1).
+Complex delay line `z` size is `ord`, it is updated for the next kernel call.
+Vector `y` can be the same as `x`.
+*******************************************************************************/
+int filter_iir_cmplx_coeff_krn(complex_t* b, complex_t* a, int ord,
+                               complex_t* z, complex_t* x, int n, complex_t* y)
+{
+  complex_t xk, yk;
+  unsigned int csr;
+  int k, m;
+
+  csr = dspl_ftz_enter();
+  for(k = 0; k < n; k++)
+  {
+    RE(xk) = RE(x[k]);
+    IM(xk) = IM(x[k]);
+    RE(yk) = CMRE(b[0], xk) + RE(z[0]);
+    IM(yk) = CMIM(b[0], xk) + IM(z[0]);
+    for(m = 0; m < ord-1; m++)
+    {
+      RE(z[m]) = RE(z[m+1]) + CMRE(b[m+1], xk) - CMRE(a[m+1], yk);
+      IM(z[m]) = IM(z[m+1]) + CMIM(b[m+1], xk) - CMIM(a[m+1], yk);
+    }
+    RE(z[ord-1]) = CMRE(b[ord], xk) - CMRE(a[ord], yk);
+    IM(z[ord-1]) = CMIM(b[ord], xk) - CMIM(a[ord], yk);
+    RE(y[k]) = RE(yk);
+    IM(y[k]) = IM(yk);
+  }
+  dspl_ftz_leave(csr);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+FIR filter kernel with symmetric impulse response.
+Output `y(k)` is calculated by samples `x(k) ... x(k+nh-1)`
+(`x(k+nh-1)` is the newest sample). Mirrored samples are added (subtracted)
+before multiplication for symmetric (antisymmetric) impulse response.
+Outputs are calculated by blocks from the end, so `y` can be the same as
+`x + nh - 1`.
+*******************************************************************************/
+int fir_sym_krn(double* h, int nh, int sym, double* x, int n, double* y)
+{
+  double acc[DSPL_CONV_BLOCK];
+  double *px, hi;
+  int i, t, m, len, nq;
+
+  nq = nh / 2;
+  for(m = n; m > 0; m -= len)
+  {
+    len = m < DSPL_CONV_BLOCK ? m : DSPL_CONV_BLOCK;
+    px = x + m - len;
+    for(t = 0; t < len; t++)
+      acc[t] = 0.0;
+
+    switch(sym)
+    {
+      case DSPL_FIR_SYMMETRIC:
+        for(i = 0; i < nq; i++)
+        {
+          hi = h[i];
+          for(t = 0; t < len; t++)
+            acc[t] += hi * (px[t + nh - 1 - i] + px[t + i]);
+        }
+        if(nh % 2)
+        {
+          hi = h[nq];
+          for(t = 0; t < len; t++)
+            acc[t] += hi * px[t + nq];
+        }
+        break;
+      case DSPL_FIR_ANTISYMMETRIC:
+        for(i = 0; i < nq; i++)
+        {
+          hi = h[i];
+          for(t = 0; t < len; t++)
+            acc[t] += hi * (px[t + nh - 1 - i] - px[t + i]);
+        }
+        break;
+      default:
+        for(i = 0; i < nh; i++)
+        {
+          hi = h[i];
+          for(t = 0; t < len; t++)
+            acc[t] += hi * px[t + nh - 1 - i];
+        }
+    }
+    memcpy(y + m - len, acc, len * sizeof(double));
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Real IIR filter kernel for the cascade of second order sections.
+Each section is transposed direct form II. Signal is processed
+by blocks of DSPL_SOS_BLOCK samples. Sections are calculated by groups of
+up to four sections sample by sample, so the recursions of the different
+sections in a group are independent and are calculated in parallel by CPU.
+Delay line `z` size is `2*nsec`, it is updated for the next kernel call.
+Vector `y` can be the same as `x`.
+*******************************************************************************/
+int filter_sos_krn(double* sos, int nsec, double* z,
+                   double* x, int n, double* y)
+{
+  double c[4][5], d[4][2];
+  double xk, yk, g;
+  double *src;
+  unsigned int csr;
+  int i, k, s, m, ng, len;
+
+  csr = dspl_ftz_enter();
+  for(i = 0; i < n; i += DSPL_SOS_BLOCK)
+  {
+    len = (n - i < DSPL_SOS_BLOCK) ? n - i : DSPL_SOS_BLOCK;
+    src = x + i;
+    for(s = 0; s < nsec; s += ng)
+    {
+      ng = nsec - s < 4 ? (nsec - s < 2 ? 1 : 2) : 4;
+
+      /* normalized group coefficients and delay line */
+      for(m = 0; m < ng; m++)
+      {
+        g = 1.0 / sos[6*(s+m)+3];
+        c[m][0] = sos[6*(s+m)]   * g;
+        c[m][1] = sos[6*(s+m)+1] * g;
+        c[m][2] = sos[6*(s+m)+2] * g;
+        c[m][3] = sos[6*(s+m)+4] * g;
+        c[m][4] = sos[6*(s+m)+5] * g;
+        d[m][0] = z[2*(s+m)];
+        d[m][1] = z[2*(s+m)+1];
+      }
+
+      switch(ng)
+      {
+        case 4:
+          for(k = 0; k < len; k++)
+          {
+            xk = src[k];
+            SOS_STEP(xk, yk, c[0], d[0]);
+            SOS_STEP(yk, xk, c[1], d[1]);
+            SOS_STEP(xk, yk, c[2], d[2]);
+            SOS_STEP(yk, xk, c[3], d[3]);
+            y[i+k] = xk;
+          }
+          break;
+        case 2:
+          for(k = 0; k < len; k++)
+          {
+            xk = src[k];
+            SOS_STEP(xk, yk, c[0], d[0]);
+            SOS_STEP(yk, xk, c[1], d[1]);
+            y[i+k] = xk;
+          }
+          break;
+        default:
+          for(k = 0; k < len; k++)
+          {
+            xk = src[k];
+            SOS_STEP(xk, yk, c[0], d[0]);
+            y[i+k] = yk;
+          }
+      }
+
+      for(m = 0; m < ng; m++)
+      {
+        z[2*(s+m)]   = d[m][0];
+        z[2*(s+m)+1] = d[m][1];
+      }
+      src = y + i;
+    }
+  }
+  dspl_ftz_leave(csr);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Multichannel real IIR filter kernel. Transposed direct form II.
+Kernel filters group of ng <= DSPL_MCH_LANES channels.
+Sample k of channel c is x[k*sx + c*sc] (y has the same layout),
+delay line element m of channel c is z[m*ldz + c].
+Each recursion step is calculated by the loops over channels
+of the group, which are vectorized by compiler.
+If a is NULL then filter is FIR. Vector `y` can be the same as `x`.
+*******************************************************************************/
+int filter_iir_mch_krn(double* b, double* a, int ord, double* z, int ldz,
+                       double* x, int sx, int sc, double* y, int n, int ng)
+{
+  double xt[DSPL_MCH_LANES], yt[DSPL_MCH_LANES];
+  double g, bm, am;
+  double *pz;
+  int k, m, c;
+
+  g = a ? 1.0 / a[0] : 0.0;
+
+  for(k = 0; k < n; k++)
+  {
+    for(c = 0; c < ng; c++)
+      xt[c] = x[k*sx + c*sc];
+
+    for(c = 0; c < ng; c++)
+      yt[c] = b[0] * xt[c] + z[c];
+
+    for(m = 0; m < ord; m++)
+    {
+      pz = z + m*ldz;
+      bm = b[m+1];
+      am = a ? a[m+1] * g : 0.0;
+      if(m < ord-1)
+        for(c = 0; c < ng; c++)
+          pz[c] = pz[ldz+c] + bm * xt[c] - am * yt[c];
+      else
+        for(c = 0; c < ng; c++)
+          pz[c] = bm * xt[c] - am * yt[c];
+    }
+
+    for(c = 0; c < ng; c++)
+      y[k*sx + c*sc] = yt[c];
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Multichannel transposed direct form II kernel with individual filter for
+each channel. Coefficient m of the channel c is b[m*ldb + c].
+Other parameters are the same as for filter_iir_mch_krn.
+*******************************************************************************/
+int filter_iir_bank_krn(double* b, double* a, int ldb, int ord,
+                        double* z, int ldz, double* x, int sx, int sc,
+                        double* y, int n, int ng)
+{
+  double xt[DSPL_MCH_LANES], yt[DSPL_MCH_LANES], g[DSPL_MCH_LANES];
+  double *pz, *pb, *pa;
+  int k, m, c;
+
+  for(c = 0; c < ng; c++)
+    g[c] = a ? 1.0 / a[c] : 0.0;
+
+  for(k = 0; k < n; k++)
+  {
+    for(c = 0; c < ng; c++)
+      xt[c] = x[k*sx + c*sc];
+
+    for(c = 0; c < ng; c++)
+      yt[c] = b[c] * xt[c] + z[c];
+
+    for(m = 0; m < ord; m++)
+    {
+      pz = z + m*ldz;
+      pb = b + (m+1)*ldb;
+      if(a)
+      {
+        pa = a + (m+1)*ldb;
+        if(m < ord-1)
+          for(c = 0; c < ng; c++)
+            pz[c] = pz[ldz+c] + pb[c] * xt[c] - pa[c] * g[c] * yt[c];
+        else
+          for(c = 0; c < ng; c++)
+            pz[c] = pb[c] * xt[c] - pa[c] * g[c] * yt[c];
+      }
+      else
+      {
+        if(m < ord-1)
+          for(c = 0; c < ng; c++)
+            pz[c] = pz[ldz+c] + pb[c] * xt[c];
+        else
+          for(c = 0; c < ng; c++)
+            pz[c] = pb[c] * xt[c];
+      }
+    }
+
+    for(c = 0; c < ng; c++)
+      y[k*sx + c*sc] = yt[c];
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Multichannel signal block transpose: y[j*ldy + i] = x[i*ldx + j],
+i = 0 ... nr-1, j = 0 ... nc-1.
+Planar channels block is transposed to the interleaved buffer before
+the multichannel kernel and back after it.
+*******************************************************************************/
+void filter_mch_transpose(double* x, int ldx, int nr, int nc,
+                          double* y, int ldy)
+{
+  int i, j;
+  for(i = 0; i < nr; i++)
+    for(j = 0; j < nc; j++)
+      y[j*ldy + i] = x[i*ldx + j];
+}
+
+
+
+
+/******************************************************************************
+Real IIR filter zero input response kernel. Transposed direct form II.
+Denominator `a` must be normalized (a[0] = 1).
+Zero input response from the delay line `z` is added to the vector `y`,
+delay line `z` is updated.
+*******************************************************************************/
+int filter_iir_zir_krn(double* a, int ord, double* z, double* y, int n)
+{
+  double yk;
+  unsigned int csr;
+  int k, m;
+
+  csr = dspl_ftz_enter();
+  for(k = 0; k < n; k++)
+  {
+    yk = z[0];
+    for(m = 0; m < ord-1; m++)
+      z[m] = z[m+1] - a[m+1] * yk;
+    z[ord-1] = - a[ord] * yk;
+    y[k] += yk;
+  }
+  dspl_ftz_leave(csr);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Transposed direct form II IIR filter state transition matrix power.
+Matrix A[ord x ord] (column-major) is A(m,0) = -a[m+1], A(m,m+1) = 1,
+denominator `a` must be normalized (a[0] = 1).
+Column `k` of A^p is calculated to `ap` as the delay line of the zero
+input recursion after `p` steps from the unit vector e_k. Repeated
+squaring of A is not used: it is unstable for the poles clustered near
+z = 1. Columns are calculated in parallel threads.
+Function returns ERROR_SIZE if A^p is not finite or is not contracting
+(1-norm of A^p is not less than 1), i.e. the block size `p` is too short
+for the filter poles.
+*******************************************************************************/
+int filter_iir_state_pow(double* a, int ord, int p, double* ap)
+{
+  double cs;
+  int k, m;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) private(m)
+#endif
+  for(k = 0; k < ord; k++)
+  {
+    double yk, *z = ap + k*ord;
+    int i;
+    memset(z, 0, ord * sizeof(double));
+    z[k] = 1.0;
+    for(i = 0; i < p; i++)
+    {
+      yk = z[0];
+      for(m = 0; m < ord-1; m++)
+        z[m] = z[m+1] - a[m+1] * yk;
+      z[ord-1] = - a[ord] * yk;
+    }
+  }
+
+  /* !(cs < 1.0) is true for inf and NaN too */
+  for(k = 0; k < ord; k++)
+  {
+    cs = 0.0;
+    for(m = 0; m < ord; m++)
+      cs += fabs(ap[m + k*ord]);
+    if(!(cs < 1.0))
+      return ERROR_SIZE;
+  }
+  return RES_OK;
+}
@@ -27,12 +27,181 @@
 #define DSPL_RAND_MOD_X1            2147483647
 #define DSPL_RAND_MOD_X2            2145483479
 
+/* SSE MXCSR flush-to-zero and denormals-are-zero scope for filter kernels */
+#if defined(__SSE__) || defined(_M_X64) || \
+   (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+  #define DSPL_FTZ_SSE
+#endif
+#define DSPL_MXCSR_FTZ              0x8000
+#define DSPL_MXCSR_DAZ              0x0040
+#define DSPL_MXCSR_FLAGS            0x003F
+
+/* thread-local storage class */
+#ifdef _MSC_VER
+  #define DSPL_THREAD_LOCAL         __declspec(thread)
+#else
+  #define DSPL_THREAD_LOCAL         __thread
+#endif
+
+int dspl_ftz_get(void);
+
+unsigned int dspl_ftz_enter(void);
+
+void dspl_ftz_leave(unsigned int csr);
+
 /* sqrt(2^31) */
 #define FFT_COMPOSITE_MAX           46340
 
 int fft_krn(complex_t* t0, complex_t* t1, fft_t* p, int n, int addr);
 
 
+/* direct convolution kernels output block size */
+#define DSPL_CONV_BLOCK             32
+#define DSPL_CONV_BLOCK_CMPLX       16
+
+int conv_krn(double* a, int na, double* b, int nb, double* c);
+
+int conv_cmplx_krn(complex_t* a, int na, complex_t* b, int nb, complex_t* c);
+
+int conv_fft_cmplx_seg(complex_t* a, int na, complex_t* B, int nb,
+                       fft_t* pfft, int nfft, int ind, int nc,
+                       complex_t* pt, complex_t* pA, complex_t* c);
+
+
+/* poly_z2a_cmplx_fft product tree leaf size
+   (leaf zeros are expanded by direct convolution) */
+#define DSPL_POLY_FFT_MIN           64
+
+int poly_mul_cmplx_fft(complex_t* a, int na, complex_t* b, int nb,
+                       complex_t* c);
+
+int poly_z2a_cmplx_tree(complex_t* z, int nz, complex_t* a);
+
+double fft_pack_scale_krn(double e0, double e1);
+
+
+/* multi-point polynomial evaluation kernels points block size
+   (Horner scheme across the block) and minimal order of the Estrin
+   scheme for single points */
+#define DSPL_POLYVAL_BLOCK          8
+#define DSPL_POLYVAL_ESTRIN_ORD     12
+
+int polyval_krn(double* a, int ord, double* x, int n, double* y);
+
+double polyval_estrin(double* a, int ord, double x);
+
+int polyval_re_cmplx_krn(double* a, int ord, complex_t* x, int n,
+                         complex_t* y);
+
+int polyval_cmplx_krn(complex_t* a, int ord, complex_t* x, int n,
+                      complex_t* y);
+
+int filter_freq_krn(double* b, double* a, int ord,
+                    complex_t* z, int nb, complex_t* h);
+
+
+int freqz_czt_conv(complex_t* y, complex_t* V, int nfft, fft_t* pfft);
+
+
+/* Aberth-Ehrlich polynomial roots iterations limit and stopping tolerance
+   relative to the Horner rounding error bound */
+#define DSPL_ROOTS_ITER_MAX         100
+#define DSPL_ROOTS_TOL              4E-16
+#define DSPL_ROOTS_NOCONV           1
+
+int polyroots_aberth(double* a, int ord, int warm, int* cnv, complex_t* r);
+
+void polyroots_aberth_eval(double* a, int ord, complex_t* z,
+                           complex_t* nwt, double* eps);
+
+
+int xcorr_fft_size(int nx, int ny, int nr);
+
+double xcorr_lag_scale(int k, int nx, int ny, int flag, double e);
+
+
+int filter_iir_krn(double* b, double* a, int ord, double* z,
+                   double* x, int n, double* y);
+
+int filter_iir_cmplx_krn(double* b, double* a, int ord, complex_t* z,
+                         complex_t* x, int n, complex_t* y);
+
+int filter_iir_cmplx_coeff_krn(complex_t* b, complex_t* a, int ord,
+                               complex_t* z, complex_t* x, int n, complex_t* y);
+
+int fir_sym_krn(double* h, int nh, int sym, double* x, int n, double* y);
+
+/* second order sections filter kernel signal block size */
+#define DSPL_SOS_BLOCK              256
+
+/* transposed direct form II second order section step:
+   input x, output y, normalized coefficients c = {b0, b1, b2, a1, a2},
+   delay line d[2] */
+#define SOS_STEP(x, y, c, d)                                  \
+{                                                             \
+  (y)    = (c)[0] * (x) + (d)[0];                             \
+  (d)[0] = (c)[1] * (x) - (c)[3] * (y) + (d)[1];              \
+  (d)[1] = (c)[2] * (x) - (c)[4] * (y);                       \
+}
+
+int filter_sos_krn(double* sos, int nsec, double* z,
+                   double* x, int n, double* y);
+
+/* multichannel IIR filter kernel maximal number of channels in a group */
+#define DSPL_MCH_LANES              16
+/* multichannel IIR filter signal block size */
+#define DSPL_MCH_BLOCK              64
+
+int filter_iir_mch_krn(double* b, double* a, int ord, double* z, int ldz,
+                       double* x, int sx, int sc, double* y, int n, int ng);
+
+int filter_iir_bank_krn(double* b, double* a, int ldb, int ord,
+                        double* z, int ldz, double* x, int sx, int sc,
+                        double* y, int n, int ng);
+
+void filter_mch_transpose(double* x, int ldx, int nr, int nc,
+                          double* y, int ldy);
+
+/* block-parallel IIR filter minimal block size */
+#define DSPL_IIR_PAR_BLOCK_MIN      4096
+
+int filter_iir_zir_krn(double* a, int ord, double* z, double* y, int n);
+
+int filter_iir_state_pow(double* a, int ord, int p, double* ap);
+
+
+/* polyphase resampling objects output signal block size */
+#define DSPL_RESAMPLE_BLOCK         256
+/* rational resampler default filter taps per polyphase component
+   and Kaiser window parameter */
+#define DSPL_RESAMPLE_TAPS          32
+#define DSPL_RESAMPLE_KAISER_BETA   8.0
+/* streaming Farrow resampler delay line size */
+#define DSPL_FARROW_HIST            3
+
+/* CIC filter accumulator bits (without sign and headroom bits),
+   input signal quantization bits limits */
+#define DSPL_CIC_ACC_BITS           62
+#define DSPL_CIC_MAX_BITS           52
+#define DSPL_CIC_MIN_BITS           16
+/* CIC compensation FIR frequency grid points per filter tap and
+   maximal compensation gain (60 dB) near the CIC response null */
+#define DSPL_CIC_COMP_GRID          16
+#define DSPL_CIC_COMP_GAIN_MAX      1E3
+
+/* half-band decimator stage input block size */
+#define DSPL_HALFBAND_BLOCK         1024
+
+int halfband_decim_krn(double* g, int ord, double* z, int n, int r,
+                       double* y);
+
+int halfband_interp_krn(double* g, int ord, double* z, int n, double* y);
+
+
+/* minimal number of independent blocks for OpenMP parallel processing */
+#define DSPL_OMP_MIN_BLOCKS         4
+
+
 void dft2 (complex_t *x,  complex_t* y);
 
 #define DFT3_W         0.866025403784439
@@ -86,6 +255,99 @@ int win_rect            (double *w, int n);
 
 int fir_linphase_lpf(int ord, double wp, int wintype, 
                      double winparam, double* h);
+
+double fir_kaiser_beta(double rs);
+
+int fir_linphase_ideal(double* t, int ord, double w0, double w1,
+                       int filter_type, double* h, double* h0);
+
+/* Remez exchange algorithm grid density, iterations limit,
+   relative convergence tolerance, minimal Q(w) on the grid and
+   barycentric interpolation node tolerance */
+#define DSPL_REMEZ_GRID             16
+#define DSPL_REMEZ_ITER_MAX         64
+#define DSPL_REMEZ_TOL              1E-6
+#define DSPL_REMEZ_QMIN             1E-6
+#define DSPL_REMEZ_XTOL             1E-14
+
+double fir_remez_q(double w, int nh, int type);
+
+int fir_remez_bary(double* x, int n, double* ad);
+
+double fir_remez_eval(double* x, double* ad, double* c, int n, double xv);
+
+int fir_remez_extr(double* e, int n, int r, int* ind);
+
+/* maximal IIR analog prototype order and stopband edge relative tolerance
+   for the minimal IIR order search */
+#define DSPL_IIR_ORD_MAX            64
+#define DSPL_IIR_ORD_TOL            1E-9
+
+/* FIR filter order search steps limit and magnitude check grid size
+   for each band in the design by specification */
+#define DSPL_FILTER_SPEC_ITER       64
+#define DSPL_FILTER_SPEC_GRID       512
+
+int filter_design_alloc(double** b, double** a, int ord);
+
+/* filter design cache */
+#define DSPL_FILTER_CACHE_IIR       0
+#define DSPL_FILTER_CACHE_FIR       1
+/* internal filter_cache_find return code if key is not found */
+#define DSPL_FILTER_CACHE_MISS      1
+
+typedef struct
+{
+  double  rp;
+  double  rs;
+  double  w0;
+  double  w1;
+  double  param;
+  int     kind;
+  int     ord;
+  int     type;
+  int     win;
+} filter_cache_key_t;
+
+typedef struct filter_cache_entry_s
+{
+  filter_cache_key_t            key;
+  double*                       c;
+  struct filter_cache_entry_s*  next;
+  unsigned int                  hash;
+  int                           n;
+} filter_cache_entry_t;
+
+void filter_cache_key_iir(filter_cache_key_t* key, double rp, double rs,
+                          int ord, double w0, double w1, int type);
+
+void filter_cache_key_fir(filter_cache_key_t* key, int ord, double w0,
+                          double w1, int type, int win_type, double param);
+
+unsigned int filter_cache_hash(filter_cache_key_t* key);
+
+int filter_cache_key_eq(filter_cache_key_t* x, filter_cache_key_t* y);
+
+void filter_cache_lock(void);
+
+void filter_cache_unlock(void);
+
+int filter_cache_find(filter_cache_key_t* key, const double** c);
+
+int filter_cache_insert(filter_cache_key_t* key, double* c0, int n0,
+                        double* c1, int n1, const double** cc);
+
+int iir_design(double rp, double rs, int ord,  double  w0, double  w1,
+               int type, double* b,  double* a);
+
+int fir_linphase_design(int ord, double w0, double w1, int filter_type,
+                        int win_type, double win_param, double* h);
+
+int filter_spec_bands(double* wp, double* ws, int type,
+                      double* bands, double* des, int* nb);
+
+int filter_spec_check(double* h, int ord, double rp, double rs,
+                      double* bands, double* des, int nb, int* ok);
                      
 #define MATRIX_SINGULAR_THRESHOLD       1E-14
                      
@@ -102,6 +364,23 @@ int fir_linphase_lpf(int ord, double wp, int wintype,
 
 int iir_ap(double rp, double rs, int ord, int type, double* b, double* a);
 
+int iir_ap_zp(double rp, double rs, int ord, int type,
+              complex_t* z, int* nz, complex_t* p, int* np);
+
+int iir_zpk_ap(double rp, double rs, int ord, int type, complex_t* za,
+               int* nz, complex_t* pa, int* np, double* h0);
+
+int iir_zpk_ft(complex_t* za, int nz, complex_t* pa, int np, double h0,
+               int ord, double w0, double w1, int type,
+               complex_t* z, complex_t* p, double* k);
+
+/* root is real if imaginary part is less than relative tolerance */
+#define DSPL_SOS_REAL_TOL               1E-10
+#define SOS_ROOT_IS_REAL(x)  (fabs(IM(x)) <= DSPL_SOS_REAL_TOL * (1.0 + ABS(x)))
+
+int filter_root_nearest(complex_t* r, int n, int* used, complex_t v,
+                        int real_only);
+
 
 #endif
 
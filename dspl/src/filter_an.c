@@ -23,6 +23,7 @@
 #include <string.h>
 #include <math.h>
 #include "dspl.h"
+#include "dspl_internal.h"
 
 
 
@@ -140,12 +141,8 @@ Complex frequency response of an analog filter H(s)
 int DSPL_API freqs(double* b, double* a, int ord,
                    double* w, int n, complex_t *h)
 {
-  complex_t jw;
-  complex_t *bc = NULL;
-  complex_t *ac = NULL;
-  complex_t num, den;
-  double mag;
-  int k;
+  complex_t jw[DSPL_POLYVAL_BLOCK];
+  int k, m, nb;
   int res;
 
   if(!b || !a || !w || !h)
@@ -155,45 +152,19 @@ int DSPL_API freqs(double* b, double* a, int ord,
   if(n<1)
     return ERROR_SIZE;
 
-  RE(jw) = 0.0;
-
-  bc = (complex_t*) malloc((ord+1) * sizeof(complex_t));
-  res = re2cmplx(b, ord+1, bc);
-
-  if( res!=RES_OK )
-    goto exit_label;
-
-  ac = (complex_t*) malloc((ord+1) * sizeof(complex_t));
-  res = re2cmplx(a, ord+1, ac);
-  if( res!=RES_OK )
-    goto exit_label;
-
-  for(k = 0; k < n; k++)
+  for(k = 0; k < n; k += DSPL_POLYVAL_BLOCK)
   {
-    IM(jw) = w[k];
-    res = polyval_cmplx(bc, ord, &jw, 1, &num);
-    if(res != RES_OK)
-      goto exit_label;
-    res = polyval_cmplx(ac, ord, &jw, 1, &den);
-    if(res != RES_OK)
-      goto exit_label;
-    mag = ABSSQR(den);
-    if(mag == 0.0)
+    nb = (n - k < DSPL_POLYVAL_BLOCK) ? n - k : DSPL_POLYVAL_BLOCK;
+    for(m = 0; m < nb; m++)
     {
-      res = ERROR_DIV_ZERO;
-      goto exit_label;
+      RE(jw[m]) = 0.0;
+      IM(jw[m]) = w[k+m];
     }
-    mag = 1.0 / mag;
-    RE(h[k]) = CMCONJRE(num, den) * mag;
-    IM(h[k]) = CMCONJIM(num, den) * mag;
+    res = filter_freq_krn(b, a, ord, jw, nb, h+k);
+    if(res != RES_OK)
+      return res;
   }
-  res = RES_OK;
-exit_label:
-  if(bc)
-    free(bc);
-  if(ac)
-    free(ac);
-  return res;
+  return RES_OK;
 }
 
 
@@ -207,11 +178,7 @@ exit_label:
 int DSPL_API freqs_cmplx(double* b, double* a, int ord,
                          complex_t* s, int n, complex_t *h)
 {
-  complex_t *bc = NULL;
-  complex_t *ac = NULL;
-  complex_t num, den;
-  double mag;
-  int k;
+  int k, nb;
   int res;
 
   if(!b || !a || !s || !h)
@@ -221,44 +188,14 @@ int DSPL_API freqs_cmplx(double* b, double* a, int ord,
   if(n<1)
     return ERROR_SIZE;
 
-
-  bc = (complex_t*) malloc((ord+1) * sizeof(complex_t));
-  res = re2cmplx(b, ord+1, bc);
-
-  if( res!=RES_OK )
-    goto exit_label;
-
-  ac = (complex_t*) malloc((ord+1) * sizeof(complex_t));
-  res = re2cmplx(a, ord+1, ac);
-  if( res!=RES_OK )
-    goto exit_label;
-
-  for(k = 0; k < n; k++)
+  for(k = 0; k < n; k += DSPL_POLYVAL_BLOCK)
   {
-    res = polyval_cmplx(bc, ord, s+k, 1, &num);
-    if(res != RES_OK)
-      goto exit_label;
-    res = polyval_cmplx(ac, ord, s+k, 1, &den);
+    nb = (n - k < DSPL_POLYVAL_BLOCK) ? n - k : DSPL_POLYVAL_BLOCK;
+    res = filter_freq_krn(b, a, ord, s+k, nb, h+k);
     if(res != RES_OK)
-      goto exit_label;
-    mag = ABSSQR(den);
-    if(mag == 0.0)
-    {
-      res = ERROR_DIV_ZERO;
-      goto exit_label;
-    }
-    mag = 1.0 / mag;
-    RE(h[k]) = CMCONJRE(num, den) * mag;
-    IM(h[k]) = CMCONJIM(num, den) * mag;
-
+      return res;
   }
-  res = RES_OK;
-  exit_label:
-  if(bc)
-    free(bc);
-  if(ac)
-    free(ac);
-  return res;
+  return RES_OK;
 }
 
 
@@ -440,17 +377,16 @@ exit_label:
 
 
 /*******************************************************************************
-Complex frequency response of a digital filter H(z)
+Complex frequency response of a digital filter H(z).
+Response on the uniform frequency grid can be calculated faster by
+freqz_fft and freqz_czt, but FFT rounding error is relative to the
+max |B(w)| and |A(w)|.
 *******************************************************************************/
 int DSPL_API freqz(double* b, double* a, int ord, double* w,
               int n, complex_t *h)
 {
-  complex_t jw;
-  complex_t *bc = NULL;
-  complex_t *ac = NULL;
-  complex_t num, den;
-  double mag;
-  int k;
+  complex_t jw[DSPL_POLYVAL_BLOCK];
+  int k, m, nb;
   int res;
 
   if(!b || !w || !h)
@@ -460,59 +396,369 @@ int DSPL_API freqz(double* b, double* a, int ord, double* w,
   if(n<1)
     return ERROR_SIZE;
 
+  /* denominator is 1 for FIR filter (a == NULL) */
+  for(k = 0; k < n; k += DSPL_POLYVAL_BLOCK)
+  {
+    nb = (n - k < DSPL_POLYVAL_BLOCK) ? n - k : DSPL_POLYVAL_BLOCK;
+    for(m = 0; m < nb; m++)
+    {
+      RE(jw[m]) =  cos(w[k+m]);
+      IM(jw[m]) = -sin(w[k+m]);
+    }
+    res = filter_freq_krn(b, a, ord, jw, nb, h+k);
+    if(res != RES_OK)
+      return res;
+  }
+  return RES_OK;
+}
+
+
+
+/*******************************************************************************
+\ingroup FILTER_ANALYSIS_GROUP
+\fn int freqz_fft(double* b, double* a, int ord, int n,
+                  fft_t* pfft, complex_t* h)
+\brief Digital filter frequency response on the uniform grid by FFT
+
+Function calculates digital filter frequency response
+\f$H(\mathrm{e}^{j\omega_k})\f$ at `n` frequencies
+\f$\omega_k = 2\pi k / n\f$, \f$k = 0 \ldots n-1\f$
+(see \ref freqz function):
+\f[
+  H(\mathrm{e}^{j\omega_k}) = \frac{B_k}{A_k}, \qquad
+  B_k = \sum_{m = 0}^{\textrm{ord}} b_m \mathrm{e}^{-j 2\pi k m / n},
+\f]
+where \f$B_k\f$ and \f$A_k\f$ are calculated by one complex FFT of
+the vector \f$b_m s + j a_m\f$. Scale \f$s\f$ is the power of 2
+which equalizes numerator and denominator energy.
+Coefficients are summed modulo `n` if `ord` is not less than `n`.
+
+Response calculation cost is \f$O(n \log n)\f$ instead of
+\f$O(n \cdot \textrm{ord})\f$ with trigonometric functions calls
+for each frequency. The FFT structure `pfft` can be used for
+the frequency response calculation of many filters without FFT twiddle
+factors recalculation.
+
+FFT rounding error is relative to the max of \f$|B_k|\f$ and
+\f$|A_k|\f$, so the response has lower precision than the \ref freqz
+direct calculation at frequencies where \f$|B_k|\f$ or \f$|A_k|\f$
+is small. For example, 100 order FIR filter response absolute error is
+about \f$10^{-11}\f$ instead of \f$10^{-14}\f$,
+IIR filter response error is about 10 times higher near the poles.
+
+\param[in]  b     Pointer to the transfer function \f$H(z)\f$
+                   numerator coefficients. /n
+                   Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the transfer function \f$H(z)\f$
+                   denominator coefficients. /n
+                   Vector size is `[ord + 1 x 1]`. /n
+                   Pointer can be `NULL` for FIR filter. /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in]  n     Number of frequencies (FFT size). /n /n
+
+\param[in]  pfft  Pointer to the FFT structure `fft_t`. /n
+                   Function changes `fft_t` structure fields so `fft_t`
+                   must be cleared before the first call. /n /n
+
+\param[out] h     Pointer to the frequency response vector. /n
+                   Vector size is `[n x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if frequency response is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API freqz_fft(double* b, double* a, int ord, int n,
+                       fft_t* pfft, complex_t* h)
+{
+  complex_t *z = NULL;
+  double s, e0, e1, br, bi, ar, ai, mag;
+  int k, km, m, err;
+
+  if(!b || !pfft || !h)
+    return ERROR_PTR;
+  if(ord<0)
+    return ERROR_FILTER_ORD;
+  if(n<1)
+    return ERROR_SIZE;
+
+  z = (complex_t*) malloc(n * sizeof(complex_t));
+  if(!z)
+    return ERROR_MALLOC;
+  memset(z, 0, n * sizeof(complex_t));
 
-  bc = (complex_t*) malloc((ord+1) * sizeof(complex_t));
-  res = re2cmplx(b, ord+1, bc);
-  if( res!=RES_OK )
+  if(!a)
+  {
+    for(m = 0; m < ord+1; m++)
+      RE(z[m % n]) += b[m];
+    err = fft_cmplx(z, n, pfft, h);
+    goto exit_label;
+  }
+
+  e0 = e1 = 0.0;
+  for(m = 0; m < ord+1; m++)
+  {
+    e0 += a[m] * a[m];
+    e1 += b[m] * b[m];
+  }
+  s = fft_pack_scale_krn(e0, e1);
+
+  for(m = 0; m < ord+1; m++)
+  {
+    RE(z[m % n]) += b[m] * s;
+    IM(z[m % n]) += a[m];
+  }
+
+  err = fft_cmplx(z, n, pfft, z);
+  if(err != RES_OK)
+    goto exit_label;
+
+  for(k = 0; k < n; k++)
+  {
+    km = k ? n - k : 0;
+
+    /* split spectrum of s*b + j*a */
+    br = 0.5 * (RE(z[k]) + RE(z[km]));
+    bi = 0.5 * (IM(z[k]) - IM(z[km]));
+    ar = 0.5 * (IM(z[k]) + IM(z[km]));
+    ai = 0.5 * (RE(z[km]) - RE(z[k]));
+
+    mag = ar * ar + ai * ai;
+    if(mag == 0.0)
+    {
+      err = ERROR_DIV_ZERO;
+      goto exit_label;
+    }
+    mag = 1.0 / (mag * s);
+    RE(h[k]) = (br * ar + bi * ai) * mag;
+    IM(h[k]) = (bi * ar - br * ai) * mag;
+  }
+
+exit_label:
+  free(z);
+  return err;
+}
+
+
+
+/*******************************************************************************
+\ingroup FILTER_ANALYSIS_GROUP
+\fn int freqz_czt(double* b, double* a, int ord, double w0, double dw,
+                  int n, fft_t* pfft, complex_t* h)
+\brief Digital filter frequency response on the uniform sub-band grid
+by the chirp z-transform
+
+Function calculates digital filter frequency response
+\f$H(\mathrm{e}^{j\omega_k})\f$ at `n` frequencies
+\f$\omega_k = \omega_0 + k \Delta\omega\f$, \f$k = 0 \ldots n-1\f$
+(see \ref freqz function).
+
+Numerator and denominator are calculated by the chirp z-transform
+(Bluestein algorithm). Substitution
+\f$km = (k^2 + m^2 - (k-m)^2) / 2\f$ transforms the sum
+\f[
+  B_k = \sum_{m = 0}^{\textrm{ord}} b_m \mathrm{e}^{-j \omega_k m} =
+  \mathrm{e}^{-j\Delta\omega k^2/2} \sum_{m = 0}^{\textrm{ord}}
+  \left( b_m \mathrm{e}^{-j(\omega_0 m + \Delta\omega m^2/2)} \right)
+  \mathrm{e}^{j\Delta\omega (k-m)^2/2}
+\f]
+to the linear convolution, which is calculated by FFT of the power of 2
+size not less than `n + ord`. So the response can be calculated
+with high resolution in the narrow band (passband ripple or transition band
+analysis) for \f$O(n \log n)\f$ operations.
+
+Convolution rounding error is relative to the max of \f$|B_k|\f$ and
+\f$|A_k|\f$ (see \ref freqz_fft function), so the function is intended
+for FIR and low order IIR filters.
+High order IIR filters response should be calculated by \ref freqz.
+
+\param[in]  b     Pointer to the transfer function \f$H(z)\f$
+                   numerator coefficients. /n
+                   Vector size is `[ord + 1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the transfer function \f$H(z)\f$
+                   denominator coefficients. /n
+                   Vector size is `[ord + 1 x 1]`. /n
+                   Pointer can be `NULL` for FIR filter. /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in]  w0    Start frequency \f$\omega_0\f$ (rad/sample). /n /n
+
+\param[in]  dw    Frequency step \f$\Delta\omega\f$ (rad/sample). /n /n
+
+\param[in]  n     Number of frequencies. /n /n
+
+\param[in]  pfft  Pointer to the FFT structure `fft_t`. /n
+                   Function changes `fft_t` structure fields so `fft_t`
+                   must be cleared before the first call. /n /n
+
+\param[out] h     Pointer to the frequency response vector. /n
+                   Vector size is `[n x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if frequency response is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API freqz_czt(double* b, double* a, int ord, double w0, double dw,
+                       int n, fft_t* pfft, complex_t* h)
+{
+  complex_t *v = NULL, *yb = NULL, *ya = NULL;
+  double phi, re, mag;
+  int k, nfft, err;
+
+  if(!b || !pfft || !h)
+    return ERROR_PTR;
+  if(ord<0)
+    return ERROR_FILTER_ORD;
+  if(n<1)
+    return ERROR_SIZE;
+
+  nfft = 2;
+  while(nfft < n + ord)
+    nfft *= 2;
+
+  v = (complex_t*) malloc(3 * nfft * sizeof(complex_t));
+  if(!v)
+    return ERROR_MALLOC;
+  yb = v  + nfft;
+  ya = yb + nfft;
+  memset(v, 0, 3 * nfft * sizeof(complex_t));
+
+  /* chirp exp(j*dw*i^2/2) for i = -ord ... n-1 */
+  for(k = 0; k < n; k++)
+  {
+    phi = 0.5 * dw * (double)k * (double)k;
+    RE(v[k]) = cos(phi);
+    IM(v[k]) = sin(phi);
+  }
+  for(k = 1; k < ord+1; k++)
+  {
+    phi = 0.5 * dw * (double)k * (double)k;
+    RE(v[nfft-k]) = cos(phi);
+    IM(v[nfft-k]) = sin(phi);
+  }
+
+  /* premultiplied coefficients */
+  for(k = 0; k < ord+1; k++)
+  {
+    phi = -(w0 + 0.5 * dw * (double)k) * (double)k;
+    RE(yb[k]) = b[k] * cos(phi);
+    IM(yb[k]) = b[k] * sin(phi);
+    if(a)
+    {
+      RE(ya[k]) = a[k] * cos(phi);
+      IM(ya[k]) = a[k] * sin(phi);
+    }
+  }
+
+  err = fft_cmplx(v, nfft, pfft, v);
+  if(err != RES_OK)
+    goto exit_label;
+  err = freqz_czt_conv(yb, v, nfft, pfft);
+  if(err != RES_OK)
     goto exit_label;
 
   if(a)
   {
-    /* IIR filter if a != NULL */
-    ac = (complex_t*) malloc((ord+1) * sizeof(complex_t));
-    res = re2cmplx(a, ord+1, ac);
-    if( res!=RES_OK )
+    err = freqz_czt_conv(ya, v, nfft, pfft);
+    if(err != RES_OK)
       goto exit_label;
+
+    /* postmultiplication chirp is cancelled in B/A */
     for(k = 0; k < n; k++)
     {
-      RE(jw) =  cos(w[k]);
-      IM(jw) = -sin(w[k]);
-      res = polyval_cmplx(bc, ord, &jw, 1, &num);
-      if(res != RES_OK)
-        goto exit_label;
-      res = polyval_cmplx(ac, ord, &jw, 1, &den);
-      if(res != RES_OK)
-        goto exit_label;
-      mag = ABSSQR(den);
+      mag = ABSSQR(ya[k]);
       if(mag == 0.0)
       {
-        res = ERROR_DIV_ZERO;
+        err = ERROR_DIV_ZERO;
         goto exit_label;
       }
       mag = 1.0 / mag;
-      RE(h[k]) = CMCONJRE(num, den) * mag;
-      IM(h[k]) = CMCONJIM(num, den) * mag;
+      RE(h[k]) = CMCONJRE(yb[k], ya[k]) * mag;
+      IM(h[k]) = CMCONJIM(yb[k], ya[k]) * mag;
     }
   }
   else
   {
-    /* FIR filter if a == NULL */
     for(k = 0; k < n; k++)
     {
-      RE(jw) =  cos(w[k]);
-      IM(jw) = -sin(w[k]);
-      res = polyval_cmplx(bc, ord, &jw, 1, h+k);
-      if(res != RES_OK)
-        goto exit_label;
+      phi = -0.5 * dw * (double)k * (double)k;
+      RE(v[0]) = cos(phi);
+      IM(v[0]) = sin(phi);
+      re       = CMRE(yb[k], v[0]);
+      IM(h[k]) = CMIM(yb[k], v[0]);
+      RE(h[k]) = re;
     }
   }
-  res = RES_OK;
+
 exit_label:
-  if(bc)
-    free(bc);
-  if(ac)
-    free(ac);
-  return res;
+  free(v);
+  return err;
+}
+
+
+
+/*******************************************************************************
+Chirp z-transform convolution y = IFFT(FFT(y) * V),
+V is the chirp spectrum. Vector y is processed in place.
+*******************************************************************************/
+int freqz_czt_conv(complex_t* y, complex_t* V, int nfft, fft_t* pfft)
+{
+  double re;
+  int k, err;
+
+  err = fft_cmplx(y, nfft, pfft, y);
+  if(err != RES_OK)
+    return err;
+  for(k = 0; k < nfft; k++)
+  {
+    re       = CMRE(y[k], V[k]);
+    IM(y[k]) = CMIM(y[k], V[k]);
+    RE(y[k]) = re;
+  }
+  return ifft_cmplx(y, nfft, pfft, y);
+}
+
+
+
+/*******************************************************************************
+Transfer function H = B(z) / A(z) with real coefficients at nb complex
+points z (nb is not more than DSPL_POLYVAL_BLOCK). A(z) = 1 if a is NULL.
+Numerator and denominator are calculated by polyval_re_cmplx_krn for all
+points at once.
+*******************************************************************************/
+int filter_freq_krn(double* b, double* a, int ord,
+                    complex_t* z, int nb, complex_t* h)
+{
+  complex_t den[DSPL_POLYVAL_BLOCK];
+  double mag, re;
+  int m;
+
+  polyval_re_cmplx_krn(b, ord, z, nb, h);
+  if(!a)
+    return RES_OK;
+
+  polyval_re_cmplx_krn(a, ord, z, nb, den);
+  for(m = 0; m < nb; m++)
+  {
+    mag = ABSSQR(den[m]);
+    if(mag == 0.0)
+      return ERROR_DIV_ZERO;
+    mag = 1.0 / mag;
+    re       = CMCONJRE(h[m], den[m]) * mag;
+    IM(h[m]) = CMCONJIM(h[m], den[m]) * mag;
+    RE(h[m]) = re;
+  }
+  return RES_OK;
 }
 
 
@@ -0,0 +1,532 @@
+/*
+* Copyright (c) 2015-2019 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser  General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "dspl.h"
+#include "dspl_internal.h"
+
+#ifdef WIN_OS
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+
+
+
+/* design cache hash table. Entries are never changed after insertion and
+   are freed only by filter_cache_enable, so shared pointers are valid
+   until the cache is disabled or resized */
+static filter_cache_entry_t** cache_tab  = NULL;
+static int                    cache_nb   = 0;
+static int                    cache_max  = 0;
+static int                    cache_cnt  = 0;
+static long long              cache_hit  = 0;
+static long long              cache_miss = 0;
+
+/* cache access mutex (OpenMP critical section is not used because library
+   functions can be called from the application threads) */
+#ifdef WIN_OS
+static SRWLOCK                cache_lock = SRWLOCK_INIT;
+#else
+static pthread_mutex_t        cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_cache_enable(int nmax)
+\brief Enable, resize or disable the filter design cache
+
+Filter design cache is disabled by default.
+If cache is enabled then \ref iir and \ref fir_linphase functions keep
+designed coefficients in the cache and repeated calls with the same
+parameters copy coefficients from the cache instead of the filter design.
+Cache key for the IIR filters is `(rp, rs, ord, w0, w1, type)`
+and `(ord, w0, w1, filter_type, win_type, win_param)` for the FIR filters.
+
+Functions \ref iir_cache and \ref fir_linphase_cache return pointers to
+the shared coefficients kept in the cache without copy.
+
+Cache access is thread-safe: cache search and insertion are protected
+by the mutex. Cached coefficients are never changed after insertion and
+are returned as constant pointers.
+Designs are not evicted: if the cache is full, new designs are calculated
+but not cached.
+
+\param[in]  nmax  Maximal number of cached designs. /n
+                  If `nmax` is zero, then cache is disabled. /n
+                  All cached designs are freed and hit and miss counters
+                  are reset by each call, so all shared pointers returned
+                  by \ref iir_cache and \ref fir_linphase_cache become
+                  invalid. Function must not be called in parallel with
+                  the filter design functions. /n /n
+
+\return
+`RES_OK` if cache is enabled (disabled) successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_cache_enable(int nmax)
+{
+  filter_cache_entry_t *e, *t;
+  int k, nb;
+
+  if(nmax < 0)
+    return ERROR_SIZE;
+
+  filter_cache_lock();
+  for(k = 0; k < cache_nb; k++)
+  {
+    e = cache_tab[k];
+    while(e)
+    {
+      t = e->next;
+      free(e);
+      e = t;
+    }
+  }
+  if(cache_tab)
+    free(cache_tab);
+  cache_tab  = NULL;
+  cache_nb   = 0;
+  cache_max  = 0;
+  cache_cnt  = 0;
+  cache_hit  = 0;
+  cache_miss = 0;
+  if(!nmax)
+  {
+    filter_cache_unlock();
+    return RES_OK;
+  }
+
+  nb = 1;
+  while(nb < nmax)
+    nb *= 2;
+  cache_tab = (filter_cache_entry_t**)
+               malloc(nb * sizeof(filter_cache_entry_t*));
+  if(!cache_tab)
+  {
+    filter_cache_unlock();
+    return ERROR_MALLOC;
+  }
+  memset(cache_tab, 0, nb * sizeof(filter_cache_entry_t*));
+  cache_nb  = nb;
+  cache_max = nmax;
+  filter_cache_unlock();
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_cache_stat(long long* hit, long long* miss, int* cnt)
+\brief Filter design cache statistics
+
+\param[out] hit   Pointer to the number of the cache hits. /n
+                  Pointer can be `NULL`. /n /n
+
+\param[out] miss  Pointer to the number of the cache misses. /n
+                  Pointer can be `NULL`. /n /n
+
+\param[out] cnt   Pointer to the number of the cached designs. /n
+                  Pointer can be `NULL`. /n /n
+
+\return
+`RES_OK` if statistics is returned successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_cache_stat(long long* hit, long long* miss, int* cnt)
+{
+  filter_cache_lock();
+  if(hit)
+    *hit = cache_hit;
+  if(miss)
+    *miss = cache_miss;
+  if(cnt)
+    *cnt = cache_cnt;
+  filter_cache_unlock();
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int iir_cache(double rp, double rs, int ord, double w0, double w1,
+                  int type, const double** b, const double** a)
+\brief Shared digital IIR filter coefficients from the design cache
+
+Function returns pointers to the digital IIR filter coefficients
+(see \ref iir) kept in the filter design cache
+(see \ref filter_cache_enable). If the filter is not in the cache,
+then it is designed and inserted to the cache.
+
+\param[in]  rp    Magnitude ripple in passband (dB). /n /n
+
+\param[in]  rs    Suppression level in stopband (dB). /n /n
+
+\param[in]  ord   Filter order. /n /n
+
+\param[in]  w0    Normalized cutoff frequency (see \ref iir). /n /n
+
+\param[in]  w1    Right cutoff frequency for bandpass and bandstop
+                  filters (see \ref iir). /n /n
+
+\param[in]  type  Filter type and approximation flags
+                  (see \ref iir). /n /n
+
+\param[out] b     Pointer to the address of the transfer function
+                  numerator. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  Coefficients are shared and must not be changed
+                  or freed. /n /n
+
+\param[out] a     Pointer to the address of the transfer function
+                  denominator. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  Coefficients are shared and must not be changed
+                  or freed. /n /n
+
+\return
+`RES_OK` if filter is returned successfully. /n
+`ERROR_FILTER_CACHE` if the cache is disabled or full. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API iir_cache(double rp, double rs, int ord, double w0, double w1,
+                       int type, const double** b, const double** a)
+{
+  filter_cache_key_t key;
+  const double *c = NULL;
+  double *t = NULL;
+  int err;
+
+  if(!b || !a)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+
+  filter_cache_key_iir(&key, rp, rs, ord, w0, w1, type);
+  err = filter_cache_find(&key, &c);
+  if(err == ERROR_FILTER_CACHE || err == RES_OK)
+    goto exit_label;
+
+  /* miss: design to the temp vector and insert */
+  t = (double*) malloc(2 * (ord+1) * sizeof(double));
+  if(!t)
+    return ERROR_MALLOC;
+  err = iir_design(rp, rs, ord, w0, w1, type, t, t + ord + 1);
+  if(err == RES_OK)
+    err = filter_cache_insert(&key, t, 2 * (ord+1), NULL, 0, &c);
+  free(t);
+
+exit_label:
+  if(err == RES_OK)
+  {
+    *b = c;
+    *a = c + ord + 1;
+  }
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FIR_FILTER_DESIGN_GROUP
+\fn int fir_linphase_cache(int ord, double w0, double w1, int filter_type,
+                           int win_type, double win_param, const double** h)
+\brief Shared linear phase FIR filter coefficients from the design cache
+
+Function returns pointer to the linear phase FIR filter impulse response
+(see \ref fir_linphase) kept in the filter design cache
+(see \ref filter_cache_enable). If the filter is not in the cache,
+then it is designed and inserted to the cache.
+
+\param[in]  ord          Filter order. /n /n
+
+\param[in]  w0           Normalized cutoff frequency
+                         (see \ref fir_linphase). /n /n
+
+\param[in]  w1           Right cutoff frequency for bandpass and bandstop
+                         filters. /n /n
+
+\param[in]  filter_type  Filter type (see \ref fir_linphase). /n /n
+
+\param[in]  win_type     Window function type (see \ref window). /n /n
+
+\param[in]  win_param    Window function parameter. /n /n
+
+\param[out] h            Pointer to the address of the filter impulse
+                         response. /n
+                         Vector size is `[ord + 1 x 1]`. /n
+                         Coefficients are shared and must not be changed
+                         or freed. /n /n
+
+\return
+`RES_OK` if filter is returned successfully. /n
+`ERROR_FILTER_CACHE` if the cache is disabled or full. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_linphase_cache(int ord, double w0, double w1,
+                                int filter_type, int win_type,
+                                double win_param, const double** h)
+{
+  filter_cache_key_t key;
+  const double *c = NULL;
+  double *t = NULL;
+  int err;
+
+  if(!h)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+
+  filter_cache_key_fir(&key, ord, w0, w1, filter_type, win_type, win_param);
+  err = filter_cache_find(&key, &c);
+  if(err == ERROR_FILTER_CACHE || err == RES_OK)
+    goto exit_label;
+
+  t = (double*) malloc((ord+1) * sizeof(double));
+  if(!t)
+    return ERROR_MALLOC;
+  err = fir_linphase_design(ord, w0, w1, filter_type, win_type, win_param, t);
+  if(err == RES_OK)
+    err = filter_cache_insert(&key, t, ord+1, NULL, 0, &c);
+  free(t);
+
+exit_label:
+  if(err == RES_OK)
+    *h = c;
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Filter design cache keys
+*******************************************************************************/
+void filter_cache_key_iir(filter_cache_key_t* key, double rp, double rs,
+                          int ord, double w0, double w1, int type)
+{
+  memset(key, 0, sizeof(filter_cache_key_t));
+  key->kind = DSPL_FILTER_CACHE_IIR;
+  key->rp   = rp;
+  key->rs   = rs;
+  key->ord  = ord;
+  key->w0   = w0;
+  key->w1   = w1;
+  key->type = type;
+}
+
+
+
+void filter_cache_key_fir(filter_cache_key_t* key, int ord, double w0,
+                          double w1, int type, int win_type, double param)
+{
+  memset(key, 0, sizeof(filter_cache_key_t));
+  key->kind  = DSPL_FILTER_CACHE_FIR;
+  key->ord   = ord;
+  key->w0    = w0;
+  key->w1    = w1;
+  key->type  = type;
+  key->win   = win_type;
+  key->param = param;
+}
+
+
+
+
+/******************************************************************************
+Filter design cache key hash (FNV-1a) and comparison
+*******************************************************************************/
+unsigned int filter_cache_hash(filter_cache_key_t* key)
+{
+  double d[5];
+  int i[4];
+  unsigned char* p;
+  unsigned int h = 2166136261U;
+  size_t k;
+
+  d[0] = key->rp;
+  d[1] = key->rs;
+  d[2] = key->w0;
+  d[3] = key->w1;
+  d[4] = key->param;
+  i[0] = key->kind;
+  i[1] = key->ord;
+  i[2] = key->type;
+  i[3] = key->win;
+
+  p = (unsigned char*)d;
+  for(k = 0; k < sizeof(d); k++)
+    h = (h ^ p[k]) * 16777619U;
+  p = (unsigned char*)i;
+  for(k = 0; k < sizeof(i); k++)
+    h = (h ^ p[k]) * 16777619U;
+  return h;
+}
+
+
+
+int filter_cache_key_eq(filter_cache_key_t* x, filter_cache_key_t* y)
+{
+  return x->kind  == y->kind  && x->ord == y->ord  && x->type == y->type &&
+         x->win   == y->win   && x->rp  == y->rp   && x->rs   == y->rs   &&
+         x->w0    == y->w0    && x->w1  == y->w1   && x->param == y->param;
+}
+
+
+
+
+/******************************************************************************
+Filter design cache mutex lock and unlock
+*******************************************************************************/
+void filter_cache_lock(void)
+{
+#ifdef WIN_OS
+  AcquireSRWLockExclusive(&cache_lock);
+#else
+  pthread_mutex_lock(&cache_lock);
+#endif
+}
+
+
+
+void filter_cache_unlock(void)
+{
+#ifdef WIN_OS
+  ReleaseSRWLockExclusive(&cache_lock);
+#else
+  pthread_mutex_unlock(&cache_lock);
+#endif
+}
+
+
+
+
+/******************************************************************************
+Filter design cache search.
+Function returns RES_OK and pointer to the cached coefficients if key is
+found, ERROR_FILTER_CACHE if cache is disabled and DSPL_FILTER_CACHE_MISS
+(internal code) if key is not found.
+*******************************************************************************/
+int filter_cache_find(filter_cache_key_t* key, const double** c)
+{
+  filter_cache_entry_t *e;
+  unsigned int h;
+  int err = ERROR_FILTER_CACHE;
+
+  h = filter_cache_hash(key);
+  filter_cache_lock();
+  if(cache_tab)
+  {
+    err = DSPL_FILTER_CACHE_MISS;
+    for(e = cache_tab[h & (cache_nb - 1)]; e; e = e->next)
+    {
+      if(e->hash == h && filter_cache_key_eq(&e->key, key))
+      {
+        *c = e->c;
+        err = RES_OK;
+        break;
+      }
+    }
+    if(err == RES_OK)
+      cache_hit++;
+    else
+      cache_miss++;
+  }
+  filter_cache_unlock();
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Filter design cache insertion.
+Function copies coefficients vectors c0 (size n0) and c1 (size n1, can be
+NULL) to the new cache entry and returns pointer to the cached
+coefficients. If the same key is inserted by other thread, then the first
+inserted coefficients are returned. If cache is disabled or full, then
+ERROR_FILTER_CACHE is returned.
+*******************************************************************************/
+int filter_cache_insert(filter_cache_key_t* key, double* c0, int n0,
+                        double* c1, int n1, const double** cc)
+{
+  filter_cache_entry_t *e, *t;
+  unsigned int h;
+  int n, err = ERROR_FILTER_CACHE;
+
+  n = n0 + (c1 ? n1 : 0);
+  e = (filter_cache_entry_t*) malloc(sizeof(filter_cache_entry_t) +
+                                     n * sizeof(double));
+  if(!e)
+    return ERROR_MALLOC;
+  h = filter_cache_hash(key);
+  e->key  = *key;
+  e->hash = h;
+  e->n    = n;
+  e->c    = (double*)(e + 1);
+  memcpy(e->c, c0, n0 * sizeof(double));
+  if(c1)
+    memcpy(e->c + n0, c1, n1 * sizeof(double));
+
+  filter_cache_lock();
+  if(cache_tab)
+  {
+    for(t = cache_tab[h & (cache_nb - 1)]; t; t = t->next)
+      if(t->hash == h && filter_cache_key_eq(&t->key, key))
+        break;
+    if(t)
+    {
+      *cc = t->c;
+      err = RES_OK;
+    }
+    else if(cache_cnt < cache_max)
+    {
+      e->next = cache_tab[h & (cache_nb - 1)];
+      cache_tab[h & (cache_nb - 1)] = e;
+      cache_cnt++;
+      *cc = e->c;
+      e = NULL;
+      err = RES_OK;
+    }
+  }
+  filter_cache_unlock();
+  if(e)
+    free(e);
+  return err;
+}
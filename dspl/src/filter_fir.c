@@ -31,34 +31,8 @@
 int fir_linphase_lpf(int ord, double wp, int win_type, 
                      double win_param, double* h)
 {
-  int n, err = RES_OK;
-  double *w = NULL;
-  
-  
-  w = (double*)malloc((ord+1)*sizeof(double));
-  
-  err = linspace(-(double)ord*0.5, (double)ord*0.5, ord+1, DSPL_SYMMETRIC, w);
-  
-  if(err!=RES_OK)
-    goto error_proc;
-  
-  err = sinc(w, ord+1, M_PI*wp, h);
-  
-  if(err!=RES_OK)
-    goto error_proc;
-
-  err = window(w, ord+1, win_type | DSPL_SYMMETRIC, win_param);
-  
-  if(err!=RES_OK)
-    goto error_proc;
-  
-  for(n = 0; n < ord+1; n++)
-    h[n] *= w[n] * wp;
-    
-error_proc:
-  if(w)
-    free(w);
-  return err;
+  return fir_linphase_design(ord, wp, 0.0, DSPL_FILTER_LPF,
+                             win_type, win_param, h);
 }
 
 
@@ -70,92 +44,863 @@ error_proc:
 int DSPL_API  fir_linphase(int ord, double w0, double w1, int filter_type, 
                            int win_type, double win_param, double* h)
 {
+  filter_cache_key_t key;
+  const double *c = NULL;
+  int err, res;
+
+  /* design cache is checked if it is enabled by filter_cache_enable */
+  err = ERROR_FILTER_CACHE;
+  if(ord > 0 && h)
+  {
+    filter_cache_key_fir(&key, ord, w0, w1, filter_type, win_type, win_param);
+    err = filter_cache_find(&key, &c);
+  }
+  if(err == RES_OK)
+  {
+    memcpy(h, c, (ord+1)*sizeof(double));
+    return RES_OK;
+  }
+
+  res = fir_linphase_design(ord, w0, w1, filter_type, win_type, win_param, h);
+  if(res == RES_OK && err == DSPL_FILTER_CACHE_MISS)
+    filter_cache_insert(&key, h, ord+1, NULL, 0, &c);
+  return res;
+}
+
+
+
+
+/******************************************************************************
+Linear phase FIR filter design (see fir_linphase) without the design cache
+*******************************************************************************/
+int fir_linphase_design(int ord, double w0, double w1, int filter_type,
+                        int win_type, double win_param, double* h)
+{
+  double *t = NULL, *win = NULL, *h0 = NULL;
   int n, err;
-  double wc, b, del;
-    
+
   if(ord<1)
     return ERROR_FILTER_ORD;
   if(w0 <= 0.0)
     return ERROR_FILTER_WP;
   if(!h)
     return ERROR_PTR;
-  
+
   switch(filter_type & DSPL_FILTER_TYPE_MASK)
   {
-    /* Lowpass FIR coefficients calculation */
     case DSPL_FILTER_LPF:
-      err = fir_linphase_lpf(ord, w0, win_type, win_param, h);
-      break;
-    
-    /* Highpass FIR coefficients calculation */
     case DSPL_FILTER_HPF:
-      err = fir_linphase_lpf(ord, 1.0-w0, win_type, win_param, h);
-      if(err == RES_OK)
-      {
-        /* LPF filter frequency inversion */
-        for(n = 0; n < ord+1; n+=2)
-          h[n] = -h[n];
-      }
-      break;
-    
-    /* Bandpass FIR coefficients calculation */
-    case DSPL_FILTER_BPASS:
-      if(w1 < w0)
-      {
-        err = ERROR_FILTER_WS;
-        break;
-      }           
-      wc = (w0 + w1) * 0.5; /* central frequency  */
-      b  =  w1 - w0;        /* bandwidth          */
-      err = fir_linphase_lpf(ord, b*0.5, win_type, win_param, h);
-      if(err == RES_OK)
-      {
-        /* LPF frequency shifting to the central frequency */
-        del = 0.5 * (double)ord; 
-        for(n = 0; n < ord+1; n++)
-          h[n] *= 2.0 * cos(M_PI * ((double)n - del) * wc);
-      }
       break;
-      
-    /* BandStop FIR coefficients calculation               */
     /* ATTENTION! Bandstop filter must be even order only! */
     case DSPL_FILTER_BSTOP:
-    {  
-      double *h0 = NULL;
-      
-      /* check filter order. Return error if order is odd. */
       if(ord%2)
         return ERROR_FILTER_ORD;
-      
-      /* check frequency (w1 must be higher than w0) */
       if(w1 < w0)
-      {
-        err = ERROR_FILTER_WS;
-        break;
-      }
-      /* temp coeff vector */
-      h0 = (double*)malloc((ord+1) * sizeof(double));
-      
-      /* calculate LPF */
-      err = fir_linphase(ord, w0, 0.0, DSPL_FILTER_LPF, win_type, win_param, h0);
-      if(err!=RES_OK)
-      {
-        free(h0);
-        return err;        
-      }      
-      /* calculate HPF */      
-      err = fir_linphase(ord, w1, 0.0, DSPL_FILTER_HPF, win_type, win_param, h);
-      if(err==RES_OK)
-      {
-        /* Bandstop filter is sum of lowpass and highpass filters */
-        for(n = 0; n < ord+1; n++)
-          h[n] += h0[n];
-      }
-      free(h0);
+        return ERROR_FILTER_WS;
+      break;
+    case DSPL_FILTER_BPASS:
+      if(w1 < w0)
+        return ERROR_FILTER_WS;
+      break;
+    default:
+      return ERROR_FILTER_FT;
+  }
+
+  /* time samples, window and bandstop filter temp vector */
+  t = (double*) malloc(3 * (ord+1) * sizeof(double));
+  if(!t)
+    return ERROR_MALLOC;
+  win = t  + ord + 1;
+  h0  = win + ord + 1;
+
+  err = linspace(-(double)ord*0.5, (double)ord*0.5, ord+1,
+                 DSPL_SYMMETRIC, t);
+  if(err != RES_OK)
+    goto exit_label;
+  err = window(win, ord+1, win_type | DSPL_SYMMETRIC, win_param);
+  if(err != RES_OK)
+    goto exit_label;
+
+  /* ideal impulse response is windowed */
+  err = fir_linphase_ideal(t, ord, w0, w1, filter_type, h, h0);
+  if(err != RES_OK)
+    goto exit_label;
+  for(n = 0; n < ord+1; n++)
+    h[n] *= win[n];
+
+exit_label:
+  free(t);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FIR_FILTER_DESIGN_GROUP
+\fn int fir_linphase_bank(int ord, double* w0, double* w1, int nch,
+                          int filter_type, int win_type, double win_param,
+                          double* h)
+\brief Linear phase FIR filter bank design by the window method
+
+Function designs `nch` linear phase FIR filters of the same type, order
+and window (see \ref fir_linphase) with different cutoff frequencies
+`w0[c]`, `w1[c]`, `c = 0 ... nch-1`.
+Window function is calculated once for all channels,
+channels are designed in parallel if the library is built with OpenMP.
+
+Impulse responses are stored to the matrix with the channels in columns:
+coefficient `m` of the channel `c` filter is `h[m*nch + c]`.
+This layout is ready for multichannel filtration by
+\ref filter_iir_bank function.
+
+\param[in]  ord          Filters order. /n /n
+
+\param[in]  w0           Pointer to the channels normalized cutoff
+                         frequencies (see \ref fir_linphase). /n
+                         Vector size is `[nch x 1]`. /n /n
+
+\param[in]  w1           Pointer to the channels right cutoff frequencies
+                         for bandpass and bandstop filters. /n
+                         Vector size is `[nch x 1]`. /n
+                         Pointer can be `NULL` for lowpass and highpass
+                         filters. /n /n
+
+\param[in]  nch          Number of the filter bank channels. /n /n
+
+\param[in]  filter_type  Filter type (see \ref fir_linphase). /n /n
+
+\param[in]  win_type     Window function type (see \ref window). /n /n
+
+\param[in]  win_param    Window function parameter. /n /n
+
+\param[out] h            Pointer to the impulse responses matrix. /n
+                         Matrix size is `[(ord + 1) * nch x 1]`. /n
+                         Memory must be allocated. /n /n
+
+\return
+`RES_OK` if filter bank is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_linphase_bank(int ord, double* w0, double* w1, int nch,
+                               int filter_type, int win_type,
+                               double win_param, double* h)
+{
+  double *t = NULL, *win = NULL;
+  int c, err;
+
+  if(!w0 || !h)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+  if(nch < 1)
+    return ERROR_SIZE;
+  switch(filter_type & DSPL_FILTER_TYPE_MASK)
+  {
+    case DSPL_FILTER_LPF:
+    case DSPL_FILTER_HPF:
+      break;
+    case DSPL_FILTER_BSTOP:
+    case DSPL_FILTER_BPASS:
+      /* ATTENTION! Bandstop filter must be even order only! */
+      if((filter_type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP &&
+         ord % 2)
+        return ERROR_FILTER_ORD;
+      if(!w1)
+        return ERROR_PTR;
+      for(c = 0; c < nch; c++)
+        if(w1[c] < w0[c])
+          return ERROR_FILTER_WS;
       break;
+    default:
+      return ERROR_FILTER_FT;
+  }
+  for(c = 0; c < nch; c++)
+    if(w0[c] <= 0.0)
+      return ERROR_FILTER_WP;
+
+  /* time samples and window are calculated once for all channels */
+  t = (double*) malloc(2 * (ord+1) * sizeof(double));
+  if(!t)
+    return ERROR_MALLOC;
+  win = t + ord + 1;
+  err = linspace(-(double)ord*0.5, (double)ord*0.5, ord+1,
+                 DSPL_SYMMETRIC, t);
+  if(err != RES_OK)
+    goto exit_label;
+  err = window(win, ord+1, win_type | DSPL_SYMMETRIC, win_param);
+  if(err != RES_OK)
+    goto exit_label;
+
+#ifdef _OPENMP
+  #pragma omp parallel if(nch >= DSPL_OMP_MIN_BLOCKS)
+#endif
+  {
+    double *hc;
+    int m, werr = RES_OK;
+
+    hc = (double*) malloc(2 * (ord+1) * sizeof(double));
+    if(!hc)
+      werr = ERROR_MALLOC;
+
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for(c = 0; c < nch; c++)
+    {
+      if(werr != RES_OK)
+        continue;
+      werr = fir_linphase_ideal(t, ord, w0[c], w1 ? w1[c] : 0.0,
+                                filter_type, hc, hc + ord + 1);
+      if(werr != RES_OK)
+        continue;
+      for(m = 0; m <= ord; m++)
+        h[m*nch + c] = hc[m] * win[m];
+    }
+
+    if(werr != RES_OK)
+    {
+#ifdef _OPENMP
+      #pragma omp critical
+#endif
+      err = werr;
     }
+    if(hc)
+      free(hc);
+  }
+
+exit_label:
+  free(t);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Linear phase FIR filter ideal (not windowed) impulse response.
+Highpass, bandpass and bandstop filters are calculated from the lowpass
+ones by the frequency transformations. It is used by fir_linphase and
+fir_linphase_bank functions.
+t is time samples vector from -ord/2 to ord/2, h0 is temp vector,
+vectors size is ord+1.
+*******************************************************************************/
+int fir_linphase_ideal(double* t, int ord, double w0, double w1,
+                       int filter_type, double* h, double* h0)
+{
+  double wc;
+  int n, err;
+
+  switch(filter_type & DSPL_FILTER_TYPE_MASK)
+  {
+    case DSPL_FILTER_LPF:
+      err = sinc(t, ord+1, M_PI*w0, h);
+      for(n = 0; n < ord+1; n++)
+        h[n] *= w0;
+      break;
+    case DSPL_FILTER_HPF:
+      err = sinc(t, ord+1, M_PI*(1.0-w0), h);
+      for(n = 0; n < ord+1; n++)
+        h[n] *= (n % 2) ? (1.0-w0) : -(1.0-w0);
+      break;
+    case DSPL_FILTER_BPASS:
+      wc = (w0 + w1) * 0.5;
+      err = fir_linphase_ideal(t, ord, (w1 - w0) * 0.5, 0.0,
+                               DSPL_FILTER_LPF, h, h0);
+      for(n = 0; n < ord+1; n++)
+        h[n] *= 2.0 * cos(M_PI * t[n] * wc);
+      break;
+    case DSPL_FILTER_BSTOP:
+      err = fir_linphase_ideal(t, ord, w0, 0.0, DSPL_FILTER_LPF, h0, NULL);
+      if(err != RES_OK)
+        return err;
+      err = fir_linphase_ideal(t, ord, w1, 0.0, DSPL_FILTER_HPF, h, NULL);
+      for(n = 0; n < ord+1; n++)
+        h[n] += h0[n];
+      break;
     default:
       err = ERROR_FILTER_FT;
-  }  
+  }
   return err;
 }
+
+
+
+
+/******************************************************************************
+\ingroup FIR_FILTER_DESIGN_GROUP
+\fn int fir_halfband(int ord, int win_type, double win_param, double* h)
+\brief Half-band linear phase lowpass FIR filter design
+
+Function designs half-band lowpass FIR filter by the window method
+(see \ref fir_linphase). Cutoff frequency is 0.5 of the Nyquist frequency,
+frequency response is antisymmetric relative to the cutoff frequency,
+so passband and stopband ripples are equal.
+
+Half-band filter impulse response has central tap `h(ord/2) = 0.5` and
+every other tap equals zero:
+\f[
+  h(ord/2 + 2k) = 0, \qquad k \neq 0.
+\f]
+Zero taps are set exactly, so the half-band decimators and interpolators
+(see \ref halfband_create) skip them.
+
+\param[in]  ord        Filter order. /n
+                       Order must be `ord = 4K + 2`, so the first and the
+                       last taps are not zero. /n /n
+
+\param[in]  win_type   Window function type (see \ref window). /n /n
+
+\param[in]  win_param  Window function parameter. /n /n
+
+\param[out] h          Pointer to the filter impulse response. /n
+                       Vector size is `[ord + 1 x 1]`. /n
+                       Memory must be allocated. /n /n
+
+\return
+`RES_OK` if filter is designed successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_halfband(int ord, int win_type, double win_param, double* h)
+{
+  double s;
+  int n, err;
+
+  if(!h)
+    return ERROR_PTR;
+  if(ord < 2 || ord % 4 != 2)
+    return ERROR_FILTER_ORD;
+
+  err = fir_linphase(ord, 0.5, 0.0, DSPL_FILTER_LPF,
+                     win_type, win_param, h);
+  if(err != RES_OK)
+    return err;
+
+  /* odd taps are zero except the central one,
+     even taps are normalized to the unit DC gain */
+  s = 0.0;
+  for(n = 0; n < ord + 1; n+=2)
+    s += h[n];
+  for(n = 0; n < ord + 1; n+=2)
+  {
+    h[n]   *= 0.5 / s;
+    if(n < ord)
+      h[n+1] = 0.0;
+  }
+  h[ord / 2] = 0.5;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Kaiser window parameter for the stopband attenuation `rs` (dB)
+*******************************************************************************/
+double fir_kaiser_beta(double rs)
+{
+  if(rs > 50.0)
+    return 0.1102 * (rs - 8.7);
+  if(rs > 21.0)
+    return 0.5842 * pow(rs - 21.0, 0.4) + 0.07886 * (rs - 21.0);
+  return 0.0;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FIR_FILTER_DESIGN_GROUP
+\fn int fir_kaiser_ord(double rp, double rs, double wp, double ws,
+                       int* ord, double* beta)
+\brief Kaiser window FIR filter order estimation
+
+Function estimates order of the linear phase FIR filter designed by the
+window method (see \ref fir_linphase) with Kaiser window, and calculates
+Kaiser window parameter by the Kaiser formulas:
+\f[
+  ord = \frac{A - 7.95}{2.285 \Delta \omega}, \qquad
+  A = -20 \log_{10} \min(\delta_p, \delta_s),
+\f]
+here \f$ \Delta \omega = \pi |w_s - w_p| \f$ is the transition band width.
+Window method ripples are equal in the passband and the stopband, so the
+smallest of the passband and the stopband deviations is used.
+For bandpass and bandstop filters the narrowest transition band should be
+used. Cutoff frequency for \ref fir_linphase is the middle of the
+transition band.
+
+\param[in]  rp    Passband ripple (dB). /n /n
+
+\param[in]  rs    Stopband attenuation (dB). /n /n
+
+\param[in]  wp    Passband edge normalized to the Nyquist frequency. /n /n
+
+\param[in]  ws    Stopband edge normalized to the Nyquist frequency. /n /n
+
+\param[out] ord   Pointer to the estimated filter order. /n /n
+
+\param[out] beta  Pointer to the Kaiser window parameter. /n
+                  Pointer can be `NULL`. /n /n
+
+\return
+`RES_OK` if filter order is estimated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_kaiser_ord(double rp, double rs, double wp, double ws,
+                            int* ord, double* beta)
+{
+  double dp, ds, a, dw;
+
+  if(!ord)
+    return ERROR_PTR;
+  if(rp <= 0.0)
+    return ERROR_FILTER_RP;
+  if(rs <= 0.0)
+    return ERROR_FILTER_RS;
+  if(wp <= 0.0 || wp >= 1.0 || ws <= 0.0 || ws >= 1.0 || wp == ws)
+    return ERROR_FILTER_WS;
+
+  dp = (pow(10.0, rp / 20.0) - 1.0) / (pow(10.0, rp / 20.0) + 1.0);
+  ds = pow(10.0, -rs / 20.0);
+  a  = -20.0 * log10(dp < ds ? dp : ds);
+  dw = M_PI * fabs(ws - wp);
+
+  *ord = (a > 21.0) ? (int)ceil((a - 7.95) / (2.285 * dw)) :
+                      (int)ceil(5.794 / dw);
+  if(*ord < 1)
+    *ord = 1;
+  if(beta)
+    *beta = fir_kaiser_beta(a);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FIR_FILTER_DESIGN_GROUP
+\fn int fir_remez(int ord, double* bands, double* des, double* wt, int nb,
+                  int type, double* h)
+\brief Parks-McClellan equiripple linear phase FIR filter design
+
+Function designs linear phase FIR filter with minimal maximal weighted
+approximation error (equiripple filter) by the Remez exchange algorithm.
+Filter frequency response is
+\f[
+  H(\omega) = A(\omega) \exp(-j \omega \, ord/2)
+\f]
+for symmetric impulse response and
+\f[
+  H(\omega) = -j A(\omega) \exp(-j \omega \, ord/2)
+\f]
+for antisymmetric impulse response (Hilbert transformers and
+differentiators). Function minimizes
+\f$ \max |W(\omega)(D(\omega) - A(\omega))| \f$
+over the bands, here \f$D(\omega)\f$ is desired amplitude response which is
+linear inside each band and \f$W(\omega)\f$ is constant weight of each band.
+
+Equiripple filter needs 20-40% less taps than the window method filter
+(see \ref fir_linphase) for the same specification. Filter order can be
+estimated by \ref fir_remez_ord function.
+
+\param[in]  ord    Filter order. Filter length is `ord+1`. /n /n
+
+\param[in]  bands  Pointer to the bands edges vector. /n
+                   Edges are normalized to the Nyquist frequency and must
+                   be in ascending order in `[0, 1]` range. /n
+                   Band `k` is `[bands(2k), bands(2k+1)]`. /n
+                   Vector size is `[2*nb x 1]`. /n /n
+
+\param[in]  des    Pointer to the desired amplitude at the bands edges. /n
+                   Vector size is `[2*nb x 1]`. /n /n
+
+\param[in]  wt     Pointer to the bands weights vector. /n
+                   Vector size is `[nb x 1]`. /n
+                   Pointer can be `NULL`, then all weights are 1. /n /n
+
+\param[in]  nb     Number of bands. /n /n
+
+\param[in]  type   Impulse response type: /n
+\verbatim
+DSPL_FIR_SYMMETRIC      - symmetric impulse response
+DSPL_FIR_ANTISYMMETRIC  - antisymmetric impulse response
+\endverbatim
+/n
+
+\param[out] h      Pointer to the filter impulse response. /n
+                   Vector size is `[ord + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if filter is designed successfully. /n
+`ERROR_REMEZ` if Remez exchange algorithm does not converge. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_remez(int ord, double* bands, double* des, double* wt,
+                       int nb, int type, double* h)
+{
+  double *buf = NULL;
+  double *gw, *gd, *gwt, *ge, *x, *ad, *c, *ye;
+  int *ext = NULL, *ind = NULL;
+  double dw, w, q, dlt, num, den, emax, s, a, om;
+  int nh, nr, ng, nge, k, j, b, it, ne, err, conv;
+
+  if(!bands || !des || !h)
+    return ERROR_PTR;
+  if(ord < 1 || nb < 1)
+    return ERROR_SIZE;
+  if(type != DSPL_FIR_SYMMETRIC && type != DSPL_FIR_ANTISYMMETRIC)
+    return ERROR_FIR_SYM;
+  for(k = 0; k < 2*nb; k++)
+    if(bands[k] < 0.0 || bands[k] > 1.0 || (k && bands[k] < bands[k-1]))
+      return ERROR_FILTER_WS;
+
+  nh = ord + 1;
+  /* number of the cosine basis functions */
+  if(type == DSPL_FIR_SYMMETRIC)
+    nr = (nh % 2) ? (nh + 1) / 2 : nh / 2;
+  else
+    nr = (nh % 2) ? (nh - 1) / 2 : nh / 2;
+  if(nr < 1)
+    return ERROR_FILTER_ORD;
+
+  /* dense frequency grid */
+  dw = M_PI / (double)(DSPL_REMEZ_GRID * nr);
+  ng = 0;
+  for(b = 0; b < nb; b++)
+    ng += (int)(M_PI * (bands[2*b+1] - bands[2*b]) / dw) + 2;
+
+  buf = (double*) malloc((4 * ng + 4 * (nr + 1) + nh) * sizeof(double));
+  ext = (int*) malloc((2 * ng + nr + 1) * sizeof(int));
+  if(!buf || !ext)
+  {
+    err = ERROR_MALLOC;
+    goto exit_label;
+  }
+  gw  = buf;
+  gd  = gw  + ng;
+  gwt = gd  + ng;
+  ge  = gwt + ng;
+  x   = ge  + ng;
+  ad  = x   + nr + 1;
+  c   = ad  + nr + 1;
+  ye  = c   + nr + 1;
+  ind = ext + nr + 1;
+
+  /* grid frequencies, desired response and weights transformed by
+     Q(w) = 1, cos(w/2), sin(w), sin(w/2) for the filter types I - IV */
+  nge = 0;
+  for(b = 0; b < nb; b++)
+  {
+    j = (int)(M_PI * (bands[2*b+1] - bands[2*b]) / dw) + 1;
+    for(k = 0; k <= j; k++)
+    {
+      om = M_PI * bands[2*b] + (M_PI * (bands[2*b+1] - bands[2*b])) *
+           (double)k / (double)j;
+      q = fir_remez_q(om, nh, type);
+      if(fabs(q) < DSPL_REMEZ_QMIN)
+        continue;
+      a = (bands[2*b+1] > bands[2*b]) ?
+          (om / M_PI - bands[2*b]) / (bands[2*b+1] - bands[2*b]) : 0.0;
+      gw[nge]  = om;
+      gd[nge]  = (des[2*b] + a * (des[2*b+1] - des[2*b])) / q;
+      gwt[nge] = (wt ? wt[b] : 1.0) * q;
+      nge++;
+    }
+  }
+  if(nge < nr + 1)
+  {
+    err = ERROR_FILTER_ORD;
+    goto exit_label;
+  }
+
+  /* initial extremal frequencies are uniformly distributed on the grid */
+  for(k = 0; k <= nr; k++)
+    ext[k] = (int)((double)k * (double)(nge - 1) / (double)nr);
+
+  err = ERROR_REMEZ;
+  dlt = 0.0;
+  for(it = 0; it < DSPL_REMEZ_ITER_MAX; it++)
+  {
+    for(k = 0; k <= nr; k++)
+      x[k] = cos(gw[ext[k]]);
+
+    /* deviation by the barycentric weights of r+1 points */
+    fir_remez_bary(x, nr + 1, ad);
+    num = den = 0.0;
+    for(k = 0; k <= nr; k++)
+    {
+      s = (k % 2) ? -1.0 : 1.0;
+      num += ad[k] * gd[ext[k]];
+      den += s * ad[k] / gwt[ext[k]];
+    }
+    dlt = num / den;
+    for(k = 0; k <= nr; k++)
+      c[k] = gd[ext[k]] - ((k % 2) ? -dlt : dlt) / gwt[ext[k]];
+
+    /* weighted error on the grid, A(w) is the barycentric
+       interpolation by the first r points */
+    fir_remez_bary(x, nr, ad);
+    emax = 0.0;
+    for(j = 0; j < nge; j++)
+    {
+      ge[j] = gwt[j] * (gd[j] - fir_remez_eval(x, ad, c, nr, cos(gw[j])));
+      if(fabs(ge[j]) > emax)
+        emax = fabs(ge[j]);
+    }
+
+    /* new extremal frequencies */
+    ne = fir_remez_extr(ge, nge, nr + 1, ind);
+    if(ne < nr + 1)
+      break;
+
+    conv = (emax - fabs(dlt)) <= DSPL_REMEZ_TOL * fabs(dlt);
+    memcpy(ext, ind, (nr + 1) * sizeof(int));
+    if(conv)
+    {
+      err = RES_OK;
+      break;
+    }
+  }
+
+  /* impulse response by the frequency sampling of
+     H(w) = Q(w) P(w) exp(-jw ord/2) (multiplied by -j if antisymmetric) */
+  for(k = 0; k <= nr; k++)
+    x[k] = cos(gw[ext[k]]);
+  for(k = 0; k <= nr; k++)
+    c[k] = gd[ext[k]] - ((k % 2) ? -dlt : dlt) / gwt[ext[k]];
+  fir_remez_bary(x, nr, ad);
+  for(k = 0; k < nh; k++)
+  {
+    om = M_2PI * (double)k / (double)nh;
+    if(om > M_PI)
+      om -= M_2PI;
+    ye[k] = fir_remez_q(om, nh, type) *
+            fir_remez_eval(x, ad, c, nr, cos(om));
+  }
+  for(j = 0; j < nh; j++)
+  {
+    s = 0.0;
+    for(k = 0; k < nh; k++)
+    {
+      om = M_2PI * (double)k / (double)nh;
+      if(om > M_PI)
+        om -= M_2PI;
+      w = om * ((double)j - 0.5 * (double)ord);
+      s += (type == DSPL_FIR_SYMMETRIC) ? ye[k] * cos(w) : ye[k] * sin(w);
+    }
+    h[j] = s / (double)nh;
+  }
+
+exit_label:
+  if(buf)
+    free(buf);
+  if(ext)
+    free(ext);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FIR_FILTER_DESIGN_GROUP
+\fn int fir_remez_ord(double rp, double rs, double wp, double ws,
+                      int* ord, double* wt)
+\brief Equiripple lowpass (highpass) FIR filter order estimation
+
+Function estimates minimal order of the equiripple FIR filter
+(see \ref fir_remez) by the Herrmann formula.
+Estimated order can be 1-4 less than the minimal order satisfying the
+specification, so designed filter response should be checked.
+
+\param[in]  rp    Passband ripple (dB). /n /n
+
+\param[in]  rs    Stopband attenuation (dB). /n /n
+
+\param[in]  wp    Passband edge normalized to the Nyquist frequency. /n /n
+
+\param[in]  ws    Stopband edge normalized to the Nyquist frequency. /n /n
+
+\param[out] ord   Pointer to the estimated filter order. /n /n
+
+\param[out] wt    Pointer to the passband and stopband weights
+                  for \ref fir_remez function. /n
+                  Vector size is `[2 x 1]`. /n
+                  Pointer can be `NULL`. /n /n
+
+\return
+`RES_OK` if filter order is estimated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_remez_ord(double rp, double rs, double wp, double ws,
+                           int* ord, double* wt)
+{
+  double dp, ds, l, s, dinf, f, df, n;
+
+  if(!ord)
+    return ERROR_PTR;
+  if(rp <= 0.0)
+    return ERROR_FILTER_RP;
+  if(rs <= 0.0)
+    return ERROR_FILTER_RS;
+  if(wp <= 0.0 || wp >= 1.0 || ws <= 0.0 || ws >= 1.0 || wp == ws)
+    return ERROR_FILTER_WS;
+
+  dp = (pow(10.0, rp / 20.0) - 1.0) / (pow(10.0, rp / 20.0) + 1.0);
+  ds = pow(10.0, -rs / 20.0);
+  l  = log10(dp < ds ? ds : dp);
+  s  = log10(dp < ds ? dp : ds);
+
+  dinf = s * (5.309E-3 * l * l + 7.114E-2 * l - 4.761E-1) -
+             (2.66E-3 * l * l + 5.941E-1 * l + 4.278E-1);
+  f    = 11.01217 + 0.51244 * (l - s);
+  df   = 0.5 * fabs(ws - wp);
+  n    = dinf / df - f * df + 1.0;
+
+  *ord = (int)ceil(n) - 1;
+  if(*ord < 1)
+    *ord = 1;
+  if(wt)
+  {
+    wt[0] = 1.0;
+    wt[1] = dp / ds;
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Remez algorithm Q(w) function of the linear phase FIR filter types I - IV
+*******************************************************************************/
+double fir_remez_q(double w, int nh, int type)
+{
+  if(type == DSPL_FIR_SYMMETRIC)
+    return (nh % 2) ? 1.0 : cos(0.5 * w);
+  return (nh % 2) ? sin(w) : sin(0.5 * w);
+}
+
+
+
+
+/******************************************************************************
+Barycentric interpolation weights ad(k) = 1 / prod(x(k) - x(j)), j != k.
+Differences are multiplied by 2 to avoid overflow and underflow,
+the common scale factor is cancelled in the interpolation formulas.
+*******************************************************************************/
+int fir_remez_bary(double* x, int n, double* ad)
+{
+  double p;
+  int k, j;
+  for(k = 0; k < n; k++)
+  {
+    p = 1.0;
+    for(j = 0; j < n; j++)
+      if(j != k)
+        p *= 2.0 * (x[k] - x[j]);
+    ad[k] = 1.0 / p;
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Barycentric Lagrange interpolation of values c at points x
+*******************************************************************************/
+double fir_remez_eval(double* x, double* ad, double* c, int n, double xv)
+{
+  double num, den, d;
+  int k;
+  num = den = 0.0;
+  for(k = 0; k < n; k++)
+  {
+    d = xv - x[k];
+    if(fabs(d) < DSPL_REMEZ_XTOL)
+      return c[k];
+    d = ad[k] / d;
+    num += d * c[k];
+    den += d;
+  }
+  return num / den;
+}
+
+
+
+
+/******************************************************************************
+Remez algorithm extremal frequencies search.
+Function finds local extrema of the error function e, keeps alternation of
+the error sign and removes the smallest extrema until `r` extrema left.
+Function returns number of the found extrema.
+*******************************************************************************/
+int fir_remez_extr(double* e, int n, int r, int* ind)
+{
+  int k, j, m, ne;
+
+  /* local extrema including the grid ends */
+  ne = 0;
+  for(k = 0; k < n; k++)
+  {
+    if((k == 0     || (e[k] >= e[k-1] && e[k] > 0.0) ||
+                      (e[k] <= e[k-1] && e[k] < 0.0)) &&
+       (k == n - 1 || (e[k] >= e[k+1] && e[k] > 0.0) ||
+                      (e[k] <= e[k+1] && e[k] < 0.0)))
+    {
+      /* keep alternation: the larger of the same sign neighbours */
+      if(ne && ((e[ind[ne-1]] > 0.0) == (e[k] > 0.0)))
+      {
+        if(fabs(e[k]) > fabs(e[ind[ne-1]]))
+          ind[ne-1] = k;
+      }
+      else
+        ind[ne++] = k;
+    }
+  }
+
+  /* remove extra extrema */
+  while(ne > r)
+  {
+    if(ne - r == 1)
+    {
+      /* remove the smaller of the end extrema */
+      if(fabs(e[ind[0]]) < fabs(e[ind[ne-1]]))
+        memmove(ind, ind + 1, (ne - 1) * sizeof(int));
+      ne--;
+      continue;
+    }
+    m = 0;
+    for(k = 1; k < ne; k++)
+      if(fabs(e[ind[k]]) < fabs(e[ind[m]]))
+        m = k;
+    memmove(ind + m, ind + m + 1, (ne - m - 1) * sizeof(int));
+    ne--;
+    /* merge the same sign neighbours */
+    j = 0;
+    for(k = 1; k < ne; k++)
+    {
+      if((e[ind[k]] > 0.0) == (e[ind[j]] > 0.0))
+      {
+        if(fabs(e[ind[k]]) > fabs(e[ind[j]]))
+          ind[j] = ind[k];
+      }
+      else
+        ind[++j] = ind[k];
+    }
+    ne = j + 1;
+  }
+  return ne;
+}
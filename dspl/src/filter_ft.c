@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "dspl.h"
+#include "dspl_internal.h"
 
 
 /******************************************************************************
@@ -305,3 +306,191 @@ exit_label:
   return res;
 }
 
+
+
+
+/*******************************************************************************
+Packed FFT vectors scale kernel.
+Returns the power of 2 which equalizes energy e0 and e1 of two vectors
+packed to one complex vector, so the smaller one is not lost in
+the rounding error of the larger one.
+*******************************************************************************/
+double fft_pack_scale_krn(double e0, double e1)
+{
+  int e = 0;
+  if(e0 > 0.0 && e1 > 0.0)
+    frexp(sqrt(e0 / e1), &e);
+  return ldexp(1.0, e);
+}
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int ratcompos_fft(double* b, double* a, int n, double* c, double* d,
+                     int p, double* beta, double* alpha)
+\brief Rational composition by FFT
+
+Function calculates rational composition
+\f$Y(s) = (H \circ F)(s) = H(F(s))\f$ like \ref ratcompos function.
+
+Numerator and denominator of \f$Y(s)\f$ are evaluated at
+\f$N\f$ roots of unity (\f$N\f$ is the power of 2 not less than
+\f$np+1\f$):
+\f[
+  \beta(x)  = \sum_{i=0}^{n} b_i c^i(x) d^{n-i}(x), \qquad
+  \alpha(x) = \sum_{i=0}^{n} a_i c^i(x) d^{n-i}(x)
+\f]
+by the homogeneous Horner scheme, then coefficients are recovered by IFFT.
+Vectors `c` and `d` are transformed by one complex FFT of the vector
+\f$c + j s d\f$, `beta` and `alpha` are recovered by one IFFT
+of the vector \f$s \beta + j \alpha\f$, where scale \f$s\f$ is
+the power of 2 which equalizes packed vectors energy.
+Calculation cost is \f$O(Nn)\f$ instead of \f$O(n^3 p^2)\f$
+of \ref ratcompos function.
+
+FFT rounding error is relative to the `beta` and `alpha` vectors norm,
+so coefficients which are much less than the vector norm are lost
+(for example, high order Butterworth filter numerator coefficients
+\f$\binom{n}{m}\f$ near the vector ends). \ref ratcompos function
+should be used if all coefficients are required with high relative
+precision.
+
+\param[in]  b     Pointer to the \f$H(s)\f$ numerator coefficients. /n
+                   Vector size is `[n+1 x 1]`. /n /n
+
+\param[in]  a     Pointer to the \f$H(s)\f$ denominator coefficients. /n
+                   Vector size is `[n+1 x 1]`. /n /n
+
+\param[in]  n     \f$H(s)\f$ polynomials order. /n /n
+
+\param[in]  c     Pointer to the \f$F(s)\f$ numerator coefficients. /n
+                   Vector size is `[p+1 x 1]`. /n /n
+
+\param[in]  d     Pointer to the \f$F(s)\f$ denominator coefficients. /n
+                   Vector size is `[p+1 x 1]`. /n /n
+
+\param[in]  p     \f$F(s)\f$ polynomials order. /n /n
+
+\param[out] beta  Pointer to the \f$Y(s)\f$ numerator coefficients. /n
+                   Vector size is `[n*p+1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] alpha Pointer to the \f$Y(s)\f$ denominator coefficients. /n
+                   Vector size is `[n*p+1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if composition is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API ratcompos_fft(double* b, double* a, int n, double* c, double* d,
+                           int p, double* beta, double* alpha)
+{
+  fft_t pfft;
+  complex_t *pz = NULL, *pb = NULL, *pa = NULL;
+  complex_t cx, dx, dp;
+  double re, s, e0, e1;
+  int nfft, k, km, i, err;
+
+  if (!a || !b || !c || !d || !beta || !alpha)
+    return ERROR_PTR;
+  if(n < 1 || p < 1)
+    return ERROR_SIZE;
+
+  nfft = 2;
+  while(nfft < n*p+1)
+    nfft *= 2;
+
+  memset(&pfft, 0, sizeof(fft_t));
+  pz = (complex_t*)malloc(3 * nfft * sizeof(complex_t));
+  if(!pz)
+    return ERROR_MALLOC;
+  pb = pz + nfft;
+  pa = pb + nfft;
+
+  e0 = e1 = 0.0;
+  for(k = 0; k < p+1; k++)
+  {
+    e0 += c[k] * c[k];
+    e1 += d[k] * d[k];
+  }
+  s = fft_pack_scale_krn(e0, e1);
+
+  memset(pz, 0, nfft * sizeof(complex_t));
+  for(k = 0; k < p+1; k++)
+  {
+    RE(pz[k]) = c[k];
+    IM(pz[k]) = d[k] * s;
+  }
+
+  err = fft_cmplx(pz, nfft, &pfft, pz);
+  if(err != RES_OK)
+    goto exit_label;
+
+  s = 0.5 / s;
+  for(k = 0; k < nfft; k++)
+  {
+    km = k ? nfft - k : 0;
+
+    /* split spectrum of c + j*s*d */
+    RE(cx) = 0.5 * (RE(pz[k]) + RE(pz[km]));
+    IM(cx) = 0.5 * (IM(pz[k]) - IM(pz[km]));
+    RE(dx) = s * (IM(pz[k]) + IM(pz[km]));
+    IM(dx) = s * (RE(pz[km]) - RE(pz[k]));
+
+    RE(pb[k]) = b[n];
+    IM(pb[k]) = 0.0;
+    RE(pa[k]) = a[n];
+    IM(pa[k]) = 0.0;
+    RE(dp) = 1.0;
+    IM(dp) = 0.0;
+    for(i = n-1; i >= 0; i--)
+    {
+      re     = CMRE(dp, dx);
+      IM(dp) = CMIM(dp, dx);
+      RE(dp) = re;
+
+      re        = CMRE(pb[k], cx) + b[i] * RE(dp);
+      IM(pb[k]) = CMIM(pb[k], cx) + b[i] * IM(dp);
+      RE(pb[k]) = re;
+
+      re        = CMRE(pa[k], cx) + a[i] * RE(dp);
+      IM(pa[k]) = CMIM(pa[k], cx) + a[i] * IM(dp);
+      RE(pa[k]) = re;
+    }
+  }
+
+  e0 = e1 = 0.0;
+  for(k = 0; k < nfft; k++)
+  {
+    e0 += ABSSQR(pa[k]);
+    e1 += ABSSQR(pb[k]);
+  }
+  s = fft_pack_scale_krn(e0, e1);
+
+  for(k = 0; k < nfft; k++)
+  {
+    RE(pz[k]) = RE(pb[k]) * s - IM(pa[k]);
+    IM(pz[k]) = IM(pb[k]) * s + RE(pa[k]);
+  }
+
+  err = ifft_cmplx(pz, nfft, &pfft, pz);
+  if(err != RES_OK)
+    goto exit_label;
+
+  s = 1.0 / s;
+  for(k = 0; k < n*p+1; k++)
+  {
+    beta[k]  = RE(pz[k]) * s;
+    alpha[k] = IM(pz[k]);
+  }
+
+exit_label:
+  fft_free(&pfft);
+  free(pz);
+  return err;
+}
@@ -160,6 +160,39 @@ draws plot:
 ******************************************************************************/
 int DSPL_API iir(double rp, double rs, int ord,  double  w0, double  w1,
                                        int type, double* b,  double* a)
+{
+  filter_cache_key_t key;
+  const double *c = NULL;
+  int err, res;
+
+  /* design cache is checked if it is enabled by filter_cache_enable */
+  err = ERROR_FILTER_CACHE;
+  if(ord > 0 && b && a)
+  {
+    filter_cache_key_iir(&key, rp, rs, ord, w0, w1, type);
+    err = filter_cache_find(&key, &c);
+  }
+  if(err == RES_OK)
+  {
+    memcpy(b, c, (ord+1)*sizeof(double));
+    memcpy(a, c + ord + 1, (ord+1)*sizeof(double));
+    return RES_OK;
+  }
+
+  res = iir_design(rp, rs, ord, w0, w1, type, b, a);
+  if(res == RES_OK && err == DSPL_FILTER_CACHE_MISS)
+    filter_cache_insert(&key, b, ord+1, a, ord+1, &c);
+  return res;
+}
+
+
+
+
+/******************************************************************************
+Digital IIR filter design (see iir function) without the design cache
+*******************************************************************************/
+int iir_design(double rp, double rs, int ord,  double  w0, double  w1,
+               int type, double* b,  double* a)
 {
   double *bs = NULL;
   double *as = NULL;
@@ -286,3 +319,939 @@ int iir_ap(double rp, double rs, int ord, int type, double* b, double* a)
 
 
 
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int iir_sos(double rp, double rs, int ord, double w0, double w1,
+                int type, double* sos)
+\brief Digital IIR filter design as a cascade of second order sections
+
+Function calculates the same digital IIR filter as \ref iir function,
+but the filter transfer function is returned as a cascade of
+second order sections (biquads):
+\f[
+H(z) = \prod_{k = 0}^{L-1}
+\frac{b_{0,k} + b_{1,k} z^{-1} + b_{2,k} z^{-2}}
+     {a_{0,k} + a_{1,k} z^{-1} + a_{2,k} z^{-2}},
+\qquad L = \lfloor (ord + 1) / 2 \rfloor.
+\f]
+Zeros and poles of the analog normalized prototype are transformed
+by the frequency transformation and the bilinear transform directly,
+without the transfer function polynomials calculation, so high order
+filters (especially elliptic) keep accuracy.
+Poles closest to the unit circle are placed in the last section,
+each pole pair is combined with the nearest zeros pair.
+If filter order is odd, then the first section has the first order
+(\f$b_{2,0} = a_{2,0} = 0\f$).
+
+\param[in]  rp   Magnitude ripple in passband (dB). /n /n
+
+\param[in]  rs   Suppression level in stopband (dB). /n /n
+
+\param[in]  ord  Filter order. /n
+                 This parameter must be even for bandpass
+                 and bandstop filter type. /n /n
+
+\param[in]  w0   Normalized cutoff frequency (see \ref iir function). /n /n
+
+\param[in]  w1   Right cutoff frequency for bandpass and bandstop filter
+                 (see \ref iir function). /n /n
+
+\param[in]  type Filter type and approximation flags
+                 (see \ref iir function). /n /n
+
+\param[out] sos  Pointer to the second order sections coefficients. /n
+                 Coefficients \f$b_{0,k}, b_{1,k}, b_{2,k},
+                 a_{0,k}, a_{1,k}, a_{2,k}\f$ of the `k`-th section are
+                 `sos[6*k] ... sos[6*k+5]`. /n
+                 Vector size is `[6*L x 1]`. /n
+                 Memory must be allocated. /n /n
+
+\return
+`RES_OK`      if filter is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API iir_sos(double rp, double rs, int ord,  double  w0, double  w1,
+                     int type, double* sos)
+{
+  complex_t *z = NULL;
+  complex_t *p = NULL;
+  double k;
+  int err;
+
+  if(!sos)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+
+  z = (complex_t*) malloc(2 * ord * sizeof(complex_t));
+  if(!z)
+    return ERROR_MALLOC;
+  p = z + ord;
+
+  err = iir_zpk(rp, rs, ord, w0, w1, type, z, p, &k);
+  if(err != RES_OK)
+    goto exit_label;
+
+  err = filter_zpk2sos(z, p, ord, k, sos);
+
+exit_label:
+  free(z);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Analog prototype zeros and poles for IIR.
+Passband cutoff frequency is 1 rad/s for all approximations
+(the same as iir_ap). Vectors z and p size is ord.
+*******************************************************************************/
+int iir_ap_zp(double rp, double rs, int ord, int type,
+              complex_t* z, int* nz, complex_t* p, int* np)
+{
+  double es, gp, alpha, beta, y, wp;
+  int err, k;
+
+  switch(type & DSPL_FILTER_APPROX_MASK)
+  {
+    case DSPL_FILTER_BUTTER:
+      err = butter_ap_zp(ord, rp, z, nz, p, np);
+      break;
+    case DSPL_FILTER_CHEBY1:
+      err = cheby1_ap_zp(ord, rp, z, nz, p, np);
+      break;
+    case DSPL_FILTER_CHEBY2:
+      if(rp <= 0)
+        return  ERROR_FILTER_RP;
+      err = cheby2_ap_zp(ord, rs, z, nz, p, np);
+      if(err != RES_OK)
+        break;
+      /* passband cutoff frequency to 1 rad/s as cheby2_ap_wp1 does */
+      es = sqrt(pow(10.0, rs*0.1) - 1.0);
+      gp = pow(10.0, -rp*0.05);
+      alpha = gp * es / sqrt(1.0 - gp*gp);
+      beta = alpha + sqrt(alpha * alpha - 1.0);
+      y = log(beta)/ (double)ord;
+      wp = 2.0 / (exp(y) + exp(-y));
+      for(k = 0; k < *nz; k++)
+      {
+        RE(z[k]) /= wp;
+        IM(z[k]) /= wp;
+      }
+      for(k = 0; k < *np; k++)
+      {
+        RE(p[k]) /= wp;
+        IM(p[k]) /= wp;
+      }
+      break;
+    case DSPL_FILTER_ELLIP:
+      err = ellip_ap_zp(ord, rp, rs, z, nz, p, np);
+      break;
+    default:
+      err = ERROR_FILTER_APPROX;
+  }
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int iir_zpk(double rp, double rs, int ord, double w0, double w1,
+                int type, complex_t* z, complex_t* p, double* k)
+\brief Digital IIR filter zeros, poles and gain
+
+Function calculates zeros \f$z_n\f$, poles \f$p_n\f$ and gain \f$k\f$
+of the same digital IIR filter as \ref iir function:
+\f[
+H(z) = k \frac{\prod_{n=0}^{ord-1} (1 - z_n z^{-1})}
+               {\prod_{n=0}^{ord-1} (1 - p_n z^{-1})}.
+\f]
+Analog normalized prototype zeros and poles are mapped directly by the
+frequency transformation (lowpass, highpass, bandpass or bandstop) and by
+the bilinear transform, so no transfer function polynomials are expanded
+or composed. Computation cost is \f$O(ord)\f$ and filter roots keep
+accuracy for high orders (elliptic bandpass filters of the order 40 and
+higher), while \ref iir transfer function coefficients lose precision
+because of polynomial composition.
+
+Zeros and poles can be converted to the cascade of second order sections
+by \ref filter_zpk2sos function (see also \ref iir_sos).
+
+\param[in]  rp   Magnitude ripple in passband (dB). /n /n
+
+\param[in]  rs   Suppression level in stopband (dB). /n /n
+
+\param[in]  ord  Filter order. /n
+                 This parameter must be even for bandpass
+                 and bandstop filter type. /n /n
+
+\param[in]  w0   Normalized cutoff frequency (see \ref iir function). /n /n
+
+\param[in]  w1   Right cutoff frequency for bandpass and bandstop filter
+                 (see \ref iir function). /n /n
+
+\param[in]  type Filter type and approximation flags
+                 (see \ref iir function). /n /n
+
+\param[out] z    Pointer to the filter zeros vector. /n
+                 Infinite analog zeros are mapped to \f$z = -1\f$. /n
+                 Vector size is `[ord x 1]`. /n
+                 Memory must be allocated. /n /n
+
+\param[out] p    Pointer to the filter poles vector. /n
+                 Vector size is `[ord x 1]`. /n
+                 Memory must be allocated. /n /n
+
+\param[out] k    Pointer to the filter gain. /n /n
+
+\return
+`RES_OK`      if filter is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API iir_zpk(double rp, double rs, int ord,  double  w0, double  w1,
+                     int type, complex_t* z, complex_t* p, double* k)
+{
+  complex_t *za = NULL;
+  double h0;
+  int err, ord_ap, nz, np;
+
+  if(!z || !p || !k)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+
+  ord_ap = ord;
+  if(((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BPASS) ||
+     ((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP))
+  {
+    if(ord % 2)
+      return ERROR_FILTER_ORD_BP;
+    ord_ap = ord / 2;
+  }
+
+  za = (complex_t*) malloc(2 * ord_ap * sizeof(complex_t));
+  if(!za)
+    return ERROR_MALLOC;
+
+  err = iir_zpk_ap(rp, rs, ord_ap, type, za, &nz, za + ord_ap, &np, &h0);
+  if(err == RES_OK)
+    err = iir_zpk_ft(za, nz, za + ord_ap, np, h0, ord, w0, w1, type,
+                     z, p, k);
+  free(za);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Analog prototype zeros, poles and H(0) for iir_zpk_ft.
+Prototype is scaled so the stopband edge is 1 rad/s for HPF and BSTOP
+filters (the same as in iir function). Vectors za and pa size is ord.
+*******************************************************************************/
+int iir_zpk_ap(double rp, double rs, int ord, int type, complex_t* za,
+               int* nz, complex_t* pa, int* np, double* h0)
+{
+  double ws;
+  int err, n;
+
+  err = iir_ap_zp(rp, rs, ord, type, za, nz, pa, np);
+  if(err != RES_OK)
+    return err;
+
+  /* prototype H(0) is 1 except even order Chebyshev type 1 and elliptic
+     filters, which have passband ripple minimum at zero frequency */
+  if(!(ord % 2) && ((type & DSPL_FILTER_APPROX_MASK) == DSPL_FILTER_CHEBY1 ||
+                    (type & DSPL_FILTER_APPROX_MASK) == DSPL_FILTER_ELLIP))
+    *h0 = 1.0 / sqrt(pow(10.0, rp * 0.1));
+  else
+    *h0 = 1.0;
+
+  if(((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_HPF) ||
+     ((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP))
+  {
+    /* need frequency transform ws ->  1  rad/s   */
+    ws = filter_ws1(ord, rp, rs, type);
+    for(n = 0; n < *nz; n++)
+    {
+      RE(za[n]) /= ws;
+      IM(za[n]) /= ws;
+    }
+    for(n = 0; n < *np; n++)
+    {
+      RE(pa[n]) /= ws;
+      IM(pa[n]) /= ws;
+    }
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Analog prototype zeros and poles frequency transformation and bilinear
+transform to the digital filter zeros, poles and gain (see iir_zpk).
+Function does not allocate memory, so it is used for filter banks design.
+*******************************************************************************/
+int iir_zpk_ft(complex_t* za, int nz, complex_t* pa, int np, double h0,
+               int ord, double w0, double w1, int type,
+               complex_t* z, complex_t* p, double* k)
+{
+  complex_t zref, num, den, t, rt;
+  double wa0, wa1, bw, w2, s;
+  int n, m, cnt;
+
+  /* frequency transformation  */
+  wa0 = tan(w0 * M_PI * 0.5);
+  wa1 = tan(w1 * M_PI * 0.5);
+  bw = wa1 - wa0;
+  w2 = wa0 * wa1;
+
+  /* analog zeros are calculated to z, analog poles to p,
+     cnt is number of finite analog zeros, other zeros are infinite */
+  switch(type & DSPL_FILTER_TYPE_MASK)
+  {
+    case DSPL_FILTER_LPF:
+      for(n = 0; n < nz; n++)
+      {
+        RE(z[n]) = RE(za[n]) * wa0;
+        IM(z[n]) = IM(za[n]) * wa0;
+      }
+      for(n = 0; n < np; n++)
+      {
+        RE(p[n]) = RE(pa[n]) * wa0;
+        IM(p[n]) = IM(pa[n]) * wa0;
+      }
+      cnt = nz;
+      RE(zref) = 1.0;
+      IM(zref) = 0.0;
+      break;
+
+    case DSPL_FILTER_HPF:
+      /* s <- wa0 / s,  infinite zeros are moved to s = 0 */
+      for(n = 0; n < nz; n++)
+      {
+        s = ABSSQR(za[n]);
+        RE(z[n]) =  wa0 * RE(za[n]) / s;
+        IM(z[n]) = -wa0 * IM(za[n]) / s;
+      }
+      for(n = nz; n < np; n++)
+        RE(z[n]) = IM(z[n]) = 0.0;
+      for(n = 0; n < np; n++)
+      {
+        s = ABSSQR(pa[n]);
+        RE(p[n]) =  wa0 * RE(pa[n]) / s;
+        IM(p[n]) = -wa0 * IM(pa[n]) / s;
+      }
+      cnt = np;
+      RE(zref) = -1.0;
+      IM(zref) =  0.0;
+      break;
+
+    case DSPL_FILTER_BPASS:
+    case DSPL_FILTER_BSTOP:
+      /* each root v is transformed to two roots of the equation
+         s^2 - v * bw * s + w2 = 0 for bandpass and
+         s^2 - bw / v * s + w2 = 0 for bandstop */
+      for(m = 0; m < 2; m++)
+      {
+        complex_t* src = m ? pa : za;
+        complex_t* dst = m ? p  : z;
+        int cr = m ? np : nz;
+        for(n = 0; n < cr; n++)
+        {
+          if((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BPASS)
+          {
+            RE(t) = RE(src[n]) * bw * 0.5;
+            IM(t) = IM(src[n]) * bw * 0.5;
+          }
+          else
+          {
+            s = ABSSQR(src[n]);
+            RE(t) =  0.5 * bw * RE(src[n]) / s;
+            IM(t) = -0.5 * bw * IM(src[n]) / s;
+          }
+          RE(rt) = RE(t) * RE(t) - IM(t) * IM(t) - w2;
+          IM(rt) = 2.0 * RE(t) * IM(t);
+          sqrt_cmplx(&rt, 1, &rt);
+          RE(dst[2*n])   = RE(t) + RE(rt);
+          IM(dst[2*n])   = IM(t) + IM(rt);
+          RE(dst[2*n+1]) = RE(t) - RE(rt);
+          IM(dst[2*n+1]) = IM(t) - IM(rt);
+        }
+      }
+      if((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BPASS)
+      {
+        /* infinite prototype zeros are moved to s = 0 and s = inf */
+        for(n = 2*nz; n < nz + np; n++)
+          RE(z[n]) = IM(z[n]) = 0.0;
+        cnt = nz + np;
+        /* s = j sqrt(w2) band center frequency */
+        RE(num) = 1.0 - w2;
+        IM(num) = 2.0 * sqrt(w2);
+        s = 1.0 + w2;
+        RE(zref) = RE(num) / s;
+        IM(zref) = IM(num) / s;
+      }
+      else
+      {
+        /* infinite prototype zeros are moved to s = +/- j sqrt(w2) */
+        for(n = nz; n < np; n++)
+        {
+          RE(z[2*n]) = RE(z[2*n+1]) = 0.0;
+          IM(z[2*n])   =  sqrt(w2);
+          IM(z[2*n+1]) = -sqrt(w2);
+        }
+        cnt = 2 * np;
+        RE(zref) = 1.0;
+        IM(zref) = 0.0;
+      }
+      break;
+
+    default:
+      return ERROR_FILTER_TYPE;
+  }
+
+  /* bilinear transform z = (1 + s) / (1 - s), infinite zeros to z = -1 */
+  for(n = 0; n < ord; n++)
+  {
+    if(n < cnt)
+    {
+      RE(num) = 1.0 + RE(z[n]);
+      IM(num) = IM(z[n]);
+      RE(den) = 1.0 - RE(z[n]);
+      IM(den) = -IM(z[n]);
+      s = ABSSQR(den);
+      RE(z[n]) = CMCONJRE(num, den) / s;
+      IM(z[n]) = CMCONJIM(num, den) / s;
+    }
+    else
+    {
+      RE(z[n]) = -1.0;
+      IM(z[n]) =  0.0;
+    }
+    RE(num) = 1.0 + RE(p[n]);
+    IM(num) = IM(p[n]);
+    RE(den) = 1.0 - RE(p[n]);
+    IM(den) = -IM(p[n]);
+    s = ABSSQR(den);
+    RE(p[n]) = CMCONJRE(num, den) / s;
+    IM(p[n]) = CMCONJIM(num, den) / s;
+  }
+
+  /* gain: prod(zref - p) / prod(zref - z) * H(0) */
+  RE(num) = h0;
+  IM(num) = 0.0;
+  for(n = 0; n < ord; n++)
+  {
+    RE(den) = RE(zref) - RE(p[n]);
+    IM(den) = IM(zref) - IM(p[n]);
+    RE(t) = CMRE(num, den);
+    IM(t) = CMIM(num, den);
+    RE(den) = RE(zref) - RE(z[n]);
+    IM(den) = IM(zref) - IM(z[n]);
+    s = ABSSQR(den);
+    RE(num) = CMCONJRE(t, den) / s;
+    IM(num) = CMCONJIM(t, den) / s;
+  }
+  *k = RE(num);
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int filter_zpk2sos(complex_t* z, complex_t* p, int ord, double k,
+                       double* sos)
+\brief Digital filter zeros, poles and gain to second order sections
+
+Function converts digital filter zeros, poles and gain
+(see \ref iir_zpk) to the cascade of `L = (ord+1)/2` second order sections
+(see \ref iir_sos for the sections layout).
+Poles closest to the unit circle are placed in the last section, each pole
+pair is combined with the nearest zeros pair. Odd order filter first
+section is the first order section. Gain is placed to the first section.
+
+\param[in]  z    Pointer to the filter zeros vector. /n
+                 Complex zeros must be in conjugate pairs. /n
+                 Vector size is `[ord x 1]`. /n /n
+
+\param[in]  p    Pointer to the filter poles vector. /n
+                 Complex poles must be in conjugate pairs. /n
+                 Vector size is `[ord x 1]`. /n /n
+
+\param[in]  ord  Filter order. /n /n
+
+\param[in]  k    Filter gain. /n /n
+
+\param[out] sos  Pointer to the second order sections coefficients. /n
+                 Vector size is `[6*L x 1]`. /n
+                 Memory must be allocated. /n /n
+
+\return
+`RES_OK`      if sections are calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_zpk2sos(complex_t* z, complex_t* p, int ord, double k,
+                            double* sos)
+{
+  complex_t v;
+  double *ps;
+  double m;
+  int *uz = NULL, *up = NULL;
+  int nsec, sec, ip1, ip2, iz1, iz2, n;
+
+  if(!z || !p || !sos)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+
+  uz = (int*) malloc(2 * ord * sizeof(int));
+  if(!uz)
+    return ERROR_MALLOC;
+  up = uz + ord;
+  memset(uz, 0, 2 * ord * sizeof(int));
+
+  nsec = (ord + 1) / 2;
+  memset(sos, 0, 6 * nsec * sizeof(double));
+
+  if(ord % 2)
+  {
+    /* first order section by the real pole farthest from the unit circle */
+    ip1 = -1;
+    m = 0.0;
+    for(n = 0; n < ord; n++)
+      if(SOS_ROOT_IS_REAL(p[n]) && (ip1 < 0 || ABS(p[n]) < m))
+      {
+        ip1 = n;
+        m = ABS(p[n]);
+      }
+    if(ip1 < 0)
+      goto error_roots;
+    up[ip1] = 1;
+    iz1 = filter_root_nearest(z, ord, uz, p[ip1], 1);
+    if(iz1 < 0)
+      goto error_roots;
+    uz[iz1] = 1;
+
+    sos[0] = 1.0;
+    sos[1] = -RE(z[iz1]);
+    sos[3] = 1.0;
+    sos[4] = -RE(p[ip1]);
+  }
+
+  for(sec = nsec - 1; sec >= ord % 2; sec--)
+  {
+    /* pole closest to the unit circle and its conjugate
+       or the next real pole */
+    ip1 = -1;
+    m = 0.0;
+    for(n = 0; n < ord; n++)
+      if(!up[n] && (ip1 < 0 || ABS(p[n]) > m))
+      {
+        ip1 = n;
+        m = ABS(p[n]);
+      }
+    up[ip1] = 1;
+    if(SOS_ROOT_IS_REAL(p[ip1]))
+      ip2 = filter_root_nearest(p, ord, up, p[ip1], 1);
+    else
+    {
+      RE(v) =  RE(p[ip1]);
+      IM(v) = -IM(p[ip1]);
+      ip2 = filter_root_nearest(p, ord, up, v, 0);
+    }
+    if(ip2 < 0)
+      goto error_roots;
+    up[ip2] = 1;
+
+    /* nearest zero and its conjugate or the next nearest real zero */
+    iz1 = filter_root_nearest(z, ord, uz, p[ip1], 0);
+    if(iz1 < 0)
+      goto error_roots;
+    uz[iz1] = 1;
+    if(SOS_ROOT_IS_REAL(z[iz1]))
+      iz2 = filter_root_nearest(z, ord, uz, p[ip1], 1);
+    else
+    {
+      RE(v) =  RE(z[iz1]);
+      IM(v) = -IM(z[iz1]);
+      iz2 = filter_root_nearest(z, ord, uz, v, 0);
+    }
+    if(iz2 < 0)
+      goto error_roots;
+    uz[iz2] = 1;
+
+    ps = sos + 6 * sec;
+    ps[0] = 1.0;
+    ps[1] = -(RE(z[iz1]) + RE(z[iz2]));
+    ps[2] = CMRE(z[iz1], z[iz2]);
+    ps[3] = 1.0;
+    ps[4] = -(RE(p[ip1]) + RE(p[ip2]));
+    ps[5] = CMRE(p[ip1], p[ip2]);
+  }
+
+  sos[0] *= k;
+  sos[1] *= k;
+  sos[2] *= k;
+
+  free(uz);
+  return RES_OK;
+
+error_roots:
+  free(uz);
+  return ERROR_SOS_ROOTS;
+}
+
+
+
+
+/******************************************************************************
+Index of the not used root r[n] nearest to v.
+If real_only is nonzero, then real roots are considered only.
+Returns -1 if there is no root.
+*******************************************************************************/
+int filter_root_nearest(complex_t* r, int n, int* used, complex_t v,
+                        int real_only)
+{
+  double d, dmin = 0.0;
+  int k, ind = -1;
+
+  for(k = 0; k < n; k++)
+  {
+    if(used[k] || (real_only && !SOS_ROOT_IS_REAL(r[k])))
+      continue;
+    d = (RE(r[k]) - RE(v)) * (RE(r[k]) - RE(v)) +
+        (IM(r[k]) - IM(v)) * (IM(r[k]) - IM(v));
+    if(ind < 0 || d < dmin)
+    {
+      ind = k;
+      dmin = d;
+    }
+  }
+  return ind;
+}
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int iir_ord(double rp, double rs, double* wp, double* ws, int type,
+                int* ord, double* w)
+\brief Minimal digital IIR filter order for the given specification
+
+Function calculates minimal order of the digital IIR filter (see \ref iir)
+which provides passband ripple `rp` in the passband and suppression `rs`
+in the stopband.
+Passband and stopband edges are transformed to the analog normalized
+prototype frequencies by the bilinear transform prewarping and the
+frequency transformation inversion.
+Then minimal prototype order is found such that the prototype stopband
+edge frequency (see \ref filter_ws1) does not exceed the
+required one. So the order is exact for the library filters.
+
+\param[in]  rp    Passband ripple (dB). /n /n
+
+\param[in]  rs    Stopband suppression (dB). /n /n
+
+\param[in]  wp    Pointer to the passband edges normalized to the Nyquist
+                  frequency. /n
+                  Vector size is `[1 x 1]` for lowpass and highpass
+                  filters and `[2 x 1]` for bandpass and bandstop
+                  filters. /n /n
+
+\param[in]  ws    Pointer to the stopband edges normalized to the Nyquist
+                  frequency. /n
+                  Vector size is the same as `wp` vector size. /n /n
+
+\param[in]  type  Filter type and approximation flags
+                  (see \ref iir). /n /n
+
+\param[out] ord   Pointer to the minimal filter order. /n
+                  Order is even for bandpass and bandstop filters. /n /n
+
+\param[out] w     Pointer to the `w0` and `w1` frequencies which
+                  should be passed to \ref iir function with
+                  `ord` order to meet the specification. /n
+                  Vector size is `[2 x 1]`. /n
+                  Pointer can be `NULL`. /n /n
+
+\return
+`RES_OK` if filter order is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API iir_ord(double rp, double rs, double* wp, double* ws, int type,
+                     int* ord, double* w)
+{
+  double r, t, p0, p1, s0, s1, w2, bw, ws1;
+  int k, n;
+
+  if(!wp || !ws || !ord)
+    return ERROR_PTR;
+  if(rp <= 0.0)
+    return ERROR_FILTER_RP;
+  if(rs <= 0.0)
+    return ERROR_FILTER_RS;
+
+  n = ((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BPASS ||
+       (type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP) ? 2 : 1;
+  for(k = 0; k < n; k++)
+  {
+    if(wp[k] <= 0.0 || wp[k] >= 1.0)
+      return ERROR_FILTER_WP;
+    if(ws[k] <= 0.0 || ws[k] >= 1.0)
+      return ERROR_FILTER_WS;
+  }
+
+  /* required analog prototype stopband edge if passband edge is 1 rad/s */
+  p0 = tan(wp[0] * M_PI * 0.5);
+  s0 = tan(ws[0] * M_PI * 0.5);
+  switch(type & DSPL_FILTER_TYPE_MASK)
+  {
+    case DSPL_FILTER_LPF:
+      if(ws[0] <= wp[0])
+        return ERROR_FILTER_WS;
+      r = s0 / p0;
+      break;
+    case DSPL_FILTER_HPF:
+      if(ws[0] >= wp[0])
+        return ERROR_FILTER_WS;
+      r = p0 / s0;
+      break;
+    case DSPL_FILTER_BPASS:
+      if(ws[0] >= wp[0] || wp[0] >= wp[1] || wp[1] >= ws[1])
+        return ERROR_FILTER_WS;
+      p1 = tan(wp[1] * M_PI * 0.5);
+      s1 = tan(ws[1] * M_PI * 0.5);
+      w2 = p0 * p1;
+      bw = p1 - p0;
+      r = (w2 - s0 * s0) / (s0 * bw);
+      t = (s1 * s1 - w2) / (s1 * bw);
+      r = t < r ? t : r;
+      break;
+    case DSPL_FILTER_BSTOP:
+      if(wp[0] >= ws[0] || ws[0] >= ws[1] || ws[1] >= wp[1])
+        return ERROR_FILTER_WS;
+      p1 = tan(wp[1] * M_PI * 0.5);
+      s1 = tan(ws[1] * M_PI * 0.5);
+      w2 = s0 * s1;
+      bw = s1 - s0;
+      r = (p0 * bw) / (w2 - p0 * p0);
+      t = (p1 * bw) / (p1 * p1 - w2);
+      r = 1.0 / (t > r ? t : r);
+      break;
+    default:
+      return ERROR_FILTER_TYPE;
+  }
+  if(r <= 1.0)
+    return ERROR_FILTER_WS;
+
+  /* minimal prototype order with the stopband edge not higher than r */
+  for(k = 1; k <= DSPL_IIR_ORD_MAX; k++)
+  {
+    ws1 = filter_ws1(k, rp, rs, type);
+    if(ws1 < 0.0)
+      return ERROR_FILTER_APPROX;
+    if(ws1 <= r * (1.0 + DSPL_IIR_ORD_TOL))
+      break;
+  }
+  if(k > DSPL_IIR_ORD_MAX)
+    return ERROR_FILTER_ORD;
+
+  *ord = k * n;
+  if(w)
+  {
+    /* iir uses passband edges for LPF and BPASS
+       and stopband edges for HPF and BSTOP filters */
+    if((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_LPF ||
+       (type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BPASS)
+    {
+      w[0] = wp[0];
+      w[1] = (n == 2) ? wp[1] : 0.0;
+    }
+    else
+    {
+      w[0] = ws[0];
+      w[1] = (n == 2) ? ws[1] : 0.0;
+    }
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup IIR_FILTER_DESIGN_GROUP
+\fn int iir_bank(double rp, double rs, int ord, double* w0, double* w1,
+                 int nch, int type, double* b, double* a)
+\brief Digital IIR filter bank design
+
+Function designs `nch` digital IIR filters of the same type,
+approximation, order and ripples (see \ref iir) with different
+cutoff frequencies `w0[c]`, `w1[c]`, `c = 0 ... nch-1`.
+
+Analog prototype zeros and poles are calculated once.
+Then they are transformed for each channel by the frequency
+transformation and the bilinear transform directly (without the
+transfer function polynomials composition), and transfer function
+polynomials of each channel are expanded from the digital zeros and
+poles. Channels are designed in parallel if the library is built with
+OpenMP.
+
+Transfer function of each channel is the same as of \ref iir function,
+but the coefficients are normalized: denominator coefficient
+`a[c] = 1` (\f$a_0 = 1\f$ for each channel), while \ref iir returns
+unnormalized coefficients. Coefficients of \ref iir function are equal
+to `iir_bank` coefficients multiplied by \ref iir coefficient \f$a_0\f$.
+
+Coefficients are stored to the matrices with the channels in columns:
+coefficient `m` of the channel `c` filter is `b[m*nch + c]`.
+This layout is ready for multichannel filtration by
+\ref filter_iir_bank function.
+
+\param[in]  rp   Magnitude ripple in passband (dB). /n /n
+
+\param[in]  rs   Suppression level in stopband (dB). /n /n
+
+\param[in]  ord  Filters order. /n
+                 This parameter must be even for bandpass
+                 and bandstop filter type. /n /n
+
+\param[in]  w0   Pointer to the channels normalized cutoff frequencies
+                 (see \ref iir function). /n
+                 Vector size is `[nch x 1]`. /n /n
+
+\param[in]  w1   Pointer to the channels right cutoff frequencies for
+                 bandpass and bandstop filters. /n
+                 Vector size is `[nch x 1]`. /n
+                 Pointer can be `NULL` for lowpass and highpass
+                 filters. /n /n
+
+\param[in]  nch  Number of the filter bank channels. /n /n
+
+\param[in]  type Filter type and approximation flags
+                 (see \ref iir function). /n /n
+
+\param[out] b    Pointer to the numerators matrix. /n
+                 Matrix size is `[(ord + 1) * nch x 1]`. /n
+                 Memory must be allocated. /n /n
+
+\param[out] a    Pointer to the denominators matrix. /n
+                 Matrix size is `[(ord + 1) * nch x 1]`. /n
+                 Coefficient `a[c]` of each channel is 1. /n
+                 Memory must be allocated. /n /n
+
+\return
+`RES_OK` if filter bank is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API iir_bank(double rp, double rs, int ord, double* w0, double* w1,
+                      int nch, int type, double* b, double* a)
+{
+  complex_t *za = NULL;
+  double h0;
+  int err, ord_ap, nz, np;
+
+  if(!w0 || !b || !a)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+  if(nch < 1)
+    return ERROR_SIZE;
+
+  ord_ap = ord;
+  if(((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BPASS) ||
+     ((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP))
+  {
+    if(ord % 2)
+      return ERROR_FILTER_ORD_BP;
+    if(!w1)
+      return ERROR_PTR;
+    ord_ap = ord / 2;
+  }
+
+  /* analog prototype is calculated once for all channels */
+  za = (complex_t*) malloc(2 * ord_ap * sizeof(complex_t));
+  if(!za)
+    return ERROR_MALLOC;
+  err = iir_zpk_ap(rp, rs, ord_ap, type, za, &nz, za + ord_ap, &np, &h0);
+  if(err != RES_OK)
+    goto exit_label;
+
+#ifdef _OPENMP
+  #pragma omp parallel if(nch >= DSPL_OMP_MIN_BLOCKS)
+#endif
+  {
+    complex_t *z, *p, *acc;
+    double k;
+    int c, m, werr = RES_OK;
+
+    z = (complex_t*) malloc((3 * ord + 1) * sizeof(complex_t));
+    if(!z)
+      werr = ERROR_MALLOC;
+    p   = z + ord;
+    acc = p + ord;
+
+#ifdef _OPENMP
+    #pragma omp for schedule(static)
+#endif
+    for(c = 0; c < nch; c++)
+    {
+      if(werr != RES_OK)
+        continue;
+      werr = iir_zpk_ft(za, nz, za + ord_ap, np, h0, ord,
+                        w0[c], w1 ? w1[c] : 0.0, type, z, p, &k);
+      if(werr != RES_OK)
+        continue;
+
+      /* H(z) = k prod(1 - z(n) z^-1) / prod(1 - p(n) z^-1),
+         poly_z2a_cmplx returns ascending powers of z */
+      werr = poly_z2a_cmplx(z, ord, ord, acc);
+      if(werr != RES_OK)
+        continue;
+      for(m = 0; m <= ord; m++)
+        b[m*nch + c] = k * RE(acc[ord - m]);
+      werr = poly_z2a_cmplx(p, ord, ord, acc);
+      if(werr != RES_OK)
+        continue;
+      for(m = 0; m <= ord; m++)
+        a[m*nch + c] = RE(acc[ord - m]);
+    }
+
+    if(werr != RES_OK)
+    {
+#ifdef _OPENMP
+      #pragma omp critical
+#endif
+      err = werr;
+    }
+    if(z)
+      free(z);
+  }
+
+exit_label:
+  free(za);
+  return err;
+}
@@ -0,0 +1,359 @@
+/*
+* Copyright (c) 2015-2019 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser  General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <float.h>
+#include "dspl.h"
+#include "dspl_internal.h"
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int filter_design(double rp, double rs, double* wp, double* ws,
+                      int type, int* ord, double** b, double** a)
+\brief Minimal order digital filter design by the specification
+
+Function designs minimal order digital filter which provides passband
+ripple `rp` in the passband and suppression `rs` in the stopband for the
+given passband and stopband edges.
+
+For IIR filters (`DSPL_FILTER_BUTTER`, `DSPL_FILTER_CHEBY1`,
+`DSPL_FILTER_CHEBY2`, `DSPL_FILTER_ELLIP` approximation flags) the order is
+calculated by \ref iir_ord function and filter is designed by
+\ref iir function.
+
+For FIR filters (`DSPL_FILTER_FIR_KAISER` and `DSPL_FILTER_FIR_REMEZ`
+approximation flags) initial order is estimated by \ref fir_kaiser_ord or
+\ref fir_remez_ord function, then the filter designed by
+\ref fir_linphase with Kaiser window or by \ref fir_remez is checked and
+the order is decreased or increased until minimal order which meets the
+specification is found.
+FIR highpass and bandstop filters have even order.
+
+\param[in]  rp    Passband ripple (dB). /n /n
+
+\param[in]  rs    Stopband suppression (dB). /n /n
+
+\param[in]  wp    Pointer to the passband edges normalized to the Nyquist
+                  frequency. /n
+                  Vector size is `[1 x 1]` for lowpass and highpass
+                  filters and `[2 x 1]` for bandpass and bandstop
+                  filters. /n /n
+
+\param[in]  ws    Pointer to the stopband edges normalized to the Nyquist
+                  frequency. /n
+                  Vector size is the same as `wp` vector size. /n /n
+
+\param[in]  type  Filter type and approximation flags. /n
+                  Filter type flags are the same as for \ref iir function,
+                  approximation flags are: /n
+\verbatim
+DSPL_FILTER_BUTTER      - Butterworth IIR filter
+DSPL_FILTER_CHEBY1      - Chebyshev type 1 IIR filter
+DSPL_FILTER_CHEBY2      - Chebyshev type 2 IIR filter
+DSPL_FILTER_ELLIP       - elliptic IIR filter
+DSPL_FILTER_FIR_KAISER  - FIR filter, Kaiser window method
+DSPL_FILTER_FIR_REMEZ   - FIR filter, equiripple design
+\endverbatim
+/n
+
+\param[out] ord   Pointer to the designed filter order. /n /n
+
+\param[out] b     Pointer to the address of the filter transfer function
+                  numerator (FIR filter impulse response). /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  Memory is allocated (reallocated) by the function and
+                  must be free by user. /n /n
+
+\param[out] a     Pointer to the address of the filter transfer function
+                  denominator. /n
+                  Vector size is `[ord + 1 x 1]`. /n
+                  Memory is allocated (reallocated) by the function and
+                  must be free by user. /n
+                  Pointer can be `NULL` for FIR filters, else
+                  denominator `a = [1, 0, ... 0]` is returned. /n /n
+
+\return
+`RES_OK` if filter is designed successfully. /n
+`ERROR_FILTER_ORD` if FIR filter which meets the specification
+is not found. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API filter_design(double rp, double rs, double* wp, double* ws,
+                           int type, int* ord, double** b, double** a)
+{
+  double bands[6] = {0}, des[6], wt[3], w[2], beta = 0.0, dw;
+  int nb, n, k, step, dir, err, res, ok;
+
+  if(!wp || !ws || !ord || !b)
+    return ERROR_PTR;
+
+  switch(type & DSPL_FILTER_APPROX_MASK)
+  {
+    case DSPL_FILTER_BUTTER:
+    case DSPL_FILTER_CHEBY1:
+    case DSPL_FILTER_CHEBY2:
+    case DSPL_FILTER_ELLIP:
+      if(!a)
+        return ERROR_PTR;
+      err = iir_ord(rp, rs, wp, ws, type, &n, w);
+      if(err != RES_OK)
+        return err;
+      err = filter_design_alloc(b, a, n);
+      if(err != RES_OK)
+        return err;
+      *ord = n;
+      return iir(rp, rs, n, w[0], w[1], type, *b, *a);
+
+    case DSPL_FILTER_FIR_KAISER:
+    case DSPL_FILTER_FIR_REMEZ:
+      break;
+
+    default:
+      return ERROR_FILTER_APPROX;
+  }
+
+  err = filter_spec_bands(wp, ws, type, bands, des, &nb);
+  if(err != RES_OK)
+    return err;
+
+  /* narrowest transition band */
+  dw = 1.0;
+  for(k = 1; k < 2*nb - 1; k += 2)
+    dw = (bands[k+1] - bands[k]) < dw ? (bands[k+1] - bands[k]) : dw;
+
+  if((type & DSPL_FILTER_APPROX_MASK) == DSPL_FILTER_FIR_KAISER)
+    err = fir_kaiser_ord(rp, rs, 0.5, 0.5 + dw, &n, &beta);
+  else
+    err = fir_remez_ord(rp, rs, 0.5, 0.5 + dw, &n, w);
+  if(err != RES_OK)
+    return err;
+
+  /* remez bands weights (w is set by fir_remez_ord only) */
+  if((type & DSPL_FILTER_APPROX_MASK) == DSPL_FILTER_FIR_REMEZ)
+    for(k = 0; k < nb; k++)
+      wt[k] = (des[2*k] > 0.5) ? 1.0 : w[1];
+
+  /* highpass and bandstop FIR filters must be even order */
+  step = ((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_HPF ||
+          (type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP) ? 2 : 1;
+  n += (step == 2) ? n % 2 : 0;
+
+  /* search minimal order meeting the specification starting from
+     the estimated order: order is increased until the specification is
+     met or decreased while the specification is still met */
+  dir = 0;
+  *ord = 0;
+  for(k = 0; k < DSPL_FILTER_SPEC_ITER && n > 0; k++)
+  {
+    err = filter_design_alloc(b, a, n);
+    if(err != RES_OK)
+      return err;
+    if((type & DSPL_FILTER_APPROX_MASK) == DSPL_FILTER_FIR_KAISER)
+      res = fir_linphase(n, 0.5 * (bands[1] + bands[2]),
+                         0.5 * (bands[3] + bands[4]), type,
+                         DSPL_WIN_KAISER, beta, *b);
+    else
+      res = fir_remez(n, bands, des, wt, nb, DSPL_FIR_SYMMETRIC, *b);
+    if(res != RES_OK && res != ERROR_REMEZ)
+      return res;
+
+    ok = 0;
+    if(res == RES_OK)
+    {
+      err = filter_spec_check(*b, n, rp, rs, bands, des, nb, &ok);
+      if(err != RES_OK)
+        return err;
+    }
+
+    if(ok)
+    {
+      *ord = n;
+      if(dir > 0)
+        break;
+      dir = -1;
+      n -= step;
+    }
+    else
+    {
+      if(dir < 0)
+        break;
+      dir = 1;
+      n += step;
+    }
+  }
+  if(!(*ord))
+    return ERROR_FILTER_ORD;
+
+  /* last designed filter can be not the minimal one */
+  if(n != *ord)
+  {
+    n = *ord;
+    err = filter_design_alloc(b, a, n);
+    if(err != RES_OK)
+      return err;
+    if((type & DSPL_FILTER_APPROX_MASK) == DSPL_FILTER_FIR_KAISER)
+      err = fir_linphase(n, 0.5 * (bands[1] + bands[2]),
+                         0.5 * (bands[3] + bands[4]), type,
+                         DSPL_WIN_KAISER, beta, *b);
+    else
+      err = fir_remez(n, bands, des, wt, nb, DSPL_FIR_SYMMETRIC, *b);
+  }
+  if(a)
+  {
+    memset(*a, 0, (n+1)*sizeof(double));
+    (*a)[0] = 1.0;
+  }
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Numerator and denominator (if a != NULL) vectors realloc
+*******************************************************************************/
+int filter_design_alloc(double** b, double** a, int ord)
+{
+  double *t;
+  t = (double*) realloc(*b, (ord+1)*sizeof(double));
+  if(!t)
+    return ERROR_MALLOC;
+  *b = t;
+  if(a)
+  {
+    t = (double*) realloc(*a, (ord+1)*sizeof(double));
+    if(!t)
+      return ERROR_MALLOC;
+    *a = t;
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Bands edges and desired magnitude (at the bands edges) for the filter type.
+Bands are listed from 0 to 1 (Nyquist frequency), number of bands is 2 for
+lowpass and highpass filters and 3 for bandpass and bandstop filters.
+*******************************************************************************/
+int filter_spec_bands(double* wp, double* ws, int type,
+                      double* bands, double* des, int* nb)
+{
+  int k;
+  switch(type & DSPL_FILTER_TYPE_MASK)
+  {
+    case DSPL_FILTER_LPF:
+      if(wp[0] <= 0.0 || ws[0] <= wp[0] || ws[0] >= 1.0)
+        return ERROR_FILTER_WS;
+      bands[1] = wp[0];
+      bands[2] = ws[0];
+      *nb = 2;
+      break;
+    case DSPL_FILTER_HPF:
+      if(ws[0] <= 0.0 || wp[0] <= ws[0] || wp[0] >= 1.0)
+        return ERROR_FILTER_WS;
+      bands[1] = ws[0];
+      bands[2] = wp[0];
+      *nb = 2;
+      break;
+    case DSPL_FILTER_BPASS:
+      if(ws[0] <= 0.0 || wp[0] <= ws[0] || wp[1] <= wp[0] ||
+         ws[1] <= wp[1] || ws[1] >= 1.0)
+        return ERROR_FILTER_WS;
+      bands[1] = ws[0];
+      bands[2] = wp[0];
+      bands[3] = wp[1];
+      bands[4] = ws[1];
+      *nb = 3;
+      break;
+    case DSPL_FILTER_BSTOP:
+      if(wp[0] <= 0.0 || ws[0] <= wp[0] || ws[1] <= ws[0] ||
+         wp[1] <= ws[1] || wp[1] >= 1.0)
+        return ERROR_FILTER_WS;
+      bands[1] = wp[0];
+      bands[2] = ws[0];
+      bands[3] = ws[1];
+      bands[4] = wp[1];
+      *nb = 3;
+      break;
+    default:
+      return ERROR_FILTER_TYPE;
+  }
+  bands[0] = 0.0;
+  bands[2 * (*nb) - 1] = 1.0;
+
+  /* passband is the first band for LPF and BSTOP filters,
+     stopband is the first band for HPF and BPASS filters */
+  for(k = 0; k < *nb; k++)
+  {
+    des[2*k] = des[2*k+1] =
+      (((type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_LPF ||
+        (type & DSPL_FILTER_TYPE_MASK) == DSPL_FILTER_BSTOP) == !(k % 2)) ?
+      1.0 : 0.0;
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+FIR filter magnitude check: passband ripple must not exceed rp dB and
+stopband magnitude must not exceed -rs dB
+*******************************************************************************/
+int filter_spec_check(double* h, int ord, double rp, double rs,
+                      double* bands, double* des, int nb, int* ok)
+{
+  double w[DSPL_FILTER_SPEC_GRID], mag[DSPL_FILTER_SPEC_GRID];
+  double pmax = -DBL_MAX, pmin = DBL_MAX, smax = -DBL_MAX;
+  int k, m, err;
+
+  for(k = 0; k < nb; k++)
+  {
+    err = linspace(M_PI * bands[2*k], M_PI * bands[2*k+1],
+                   DSPL_FILTER_SPEC_GRID, DSPL_SYMMETRIC, w);
+    if(err != RES_OK)
+      return err;
+    err = filter_freq_resp(h, NULL, ord, w, DSPL_FILTER_SPEC_GRID,
+                           DSPL_FLAG_LOGMAG, mag, NULL, NULL);
+    if(err != RES_OK)
+      return err;
+    for(m = 0; m < DSPL_FILTER_SPEC_GRID; m++)
+    {
+      if(des[2*k] > 0.5)
+      {
+        pmax = mag[m] > pmax ? mag[m] : pmax;
+        pmin = mag[m] < pmin ? mag[m] : pmin;
+      }
+      else
+        smax = mag[m] > smax ? mag[m] : smax;
+    }
+  }
+  *ok = (pmax - pmin <= rp) && (smax <= -rs);
+  return RES_OK;
+}
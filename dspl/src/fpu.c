@@ -0,0 +1,126 @@
+/*
+* Copyright (c) 2015-2019 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser  General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include "dspl.h"
+#include "dspl_internal.h"
+
+#ifdef DSPL_FTZ_SSE
+#include <xmmintrin.h>
+#endif
+
+
+/* denormals flush mode of the calling thread */
+static DSPL_THREAD_LOCAL int dspl_ftz = DSPL_FTZ_OFF;
+
+
+
+
+/******************************************************************************
+\ingroup SPEC_MATH_COMMON_GROUP
+\fn int dspl_ftz_mode(int mode)
+\brief Set denormal numbers processing mode of the calling thread
+
+IIR filter recursions decay into denormal (subnormal) numbers when the input
+signal goes silent, and denormal arithmetic is 10-100 times slower
+on x86 CPUs. If the flush mode is enabled, DSPL filter kernels set
+flush-to-zero (FTZ) and denormals-are-zero (DAZ) modes of the SSE unit
+(MXCSR register) on entry and restore the caller FTZ and DAZ bits on exit,
+so the caller floating point environment is not changed. Floating point
+exception flags raised inside filter kernels are kept.
+
+Mode is thread-local: it affects DSPL filter functions called by the
+calling thread only (including the library OpenMP worker threads
+started by these functions). Mode is disabled by default, so filters
+process denormals according to IEEE-754 unless the mode is enabled.
+On CPUs without SSE this mode has no effect.
+
+\param[in]  mode  Denormals processing mode: /n
+\verbatim
+DSPL_FTZ_ON   denormals are flushed to zero inside filter kernels
+DSPL_FTZ_OFF  IEEE-754 denormals processing (default)
+\endverbatim
+
+\return
+Previous mode value.
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API dspl_ftz_mode(int mode)
+{
+  int prev = dspl_ftz;
+  dspl_ftz = mode ? DSPL_FTZ_ON : DSPL_FTZ_OFF;
+  return prev;
+}
+
+
+
+
+/******************************************************************************
+Denormals flush mode of the calling thread.
+It is passed to the OpenMP worker threads by dspl_ftz_mode.
+*******************************************************************************/
+int dspl_ftz_get(void)
+{
+  return dspl_ftz;
+}
+
+
+
+
+/******************************************************************************
+Enter flush-to-zero scope.
+Function saves current MXCSR value and sets FTZ and DAZ bits
+if the calling thread mode is DSPL_FTZ_ON.
+Returned value must be passed to dspl_ftz_leave.
+*******************************************************************************/
+unsigned int dspl_ftz_enter(void)
+{
+#ifdef DSPL_FTZ_SSE
+  unsigned int csr = _mm_getcsr();
+  if(dspl_ftz == DSPL_FTZ_ON)
+    _mm_setcsr(csr | DSPL_MXCSR_FTZ | DSPL_MXCSR_DAZ);
+  return csr;
+#else
+  return 0;
+#endif
+}
+
+
+
+
+/******************************************************************************
+Leave flush-to-zero scope.
+Function restores FTZ and DAZ bits saved by dspl_ftz_enter.
+Other control bits are not changed inside the scope, and sticky exception
+flags raised inside the scope are kept (saved flags are ORed back).
+*******************************************************************************/
+void dspl_ftz_leave(unsigned int csr)
+{
+#ifdef DSPL_FTZ_SSE
+  unsigned int cur = _mm_getcsr();
+  unsigned int mask = DSPL_MXCSR_FTZ | DSPL_MXCSR_DAZ;
+  if((cur & mask) != (csr & mask))
+    _mm_setcsr((cur & ~mask) | (csr & mask) | (csr & DSPL_MXCSR_FLAGS));
+#else
+  (void)csr;
+#endif
+}
@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "dspl.h"
+#include "dspl_internal.h"
 
 
 
@@ -245,14 +246,12 @@ int DSPL_API bessel_i0(double* x, int n, double* y)
     if(x[k] < 7.75)
     {
       x2 = x[k] * x[k] * 0.25;
-      polyval(P16, 16, &x2, 1, y+k);
-      y[k] = x2 * y[k] + 1.0;
+      y[k] = x2 * polyval_estrin(P16, 16, x2) + 1.0;
     }
     else
     {
       x2 = 1.0 / x[k];
-      polyval(P22, 22, &x2, 1, y+k);
-      y[k] *= exp(x[k]) / sqrt(x[k]);
+      y[k] = polyval_estrin(P22, 22, x2) * exp(x[k]) / sqrt(x[k]);
     }
   }
   return RES_OK;
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "dspl.h"
+#include "dspl_internal.h"
 
 
 
@@ -64,6 +65,162 @@ int DSPL_API poly_z2a_cmplx(complex_t* z, int nz, int ord, complex_t* a)
 
 
 
+/******************************************************************************
+\ingroup SPEC_MATH_COMMON_GROUP
+\fn int poly_z2a_cmplx_fft(complex_t* z, int nz, int ord, complex_t* a)
+\brief Polynomial zeros to coefficients by FFT products
+
+Function calculates complex polynomial coefficients
+\f[
+  P(x) = \prod_{k = 0}^{n_z-1} (x - z_k) = \sum_{m = 0}^{\textrm{ord}} a_m x^m
+\f]
+like \ref poly_z2a_cmplx function, but long products are calculated by
+the product tree: zeros are split into two halves, each half is expanded
+recursively and the halves are multiplied by FFT. Halves of
+`DSPL_POLY_FFT_MIN` (64) zeros and less are expanded directly.
+Calculation cost is \f$O(n_z \log^2 n_z)\f$ instead of
+\f$O(n_z^2)\f$ of \ref poly_z2a_cmplx.
+
+FFT product rounding error is relative to the coefficients vector norm,
+so coefficients which are much less than the vector norm are lost.
+For example, polynomial with 100 zeros at \f$-1\f$ has coefficients
+from 1 to \f$10^{29}\f$, and \f$a_0\f$, \f$a_{100}\f$ calculated by
+FFT have no correct digits. The function can be used when coefficients
+are used in the vector norm sense (polynomial values on the unit circle).
+\ref poly_z2a_cmplx function should be used in other cases.
+
+\param[in]  z     Pointer to the polynomial zeros vector. /n
+                   Vector size is `[nz x 1]`. /n /n
+
+\param[in]  nz    Number of zeros. /n /n
+
+\param[in]  ord   Polynomial order. /n
+                   `ord` must be not less than `nz`. /n /n
+
+\param[out] a     Pointer to the polynomial coefficients vector. /n
+                   Vector size is `[ord+1 x 1]`. /n
+                   Coefficients `a[nz+1] ... a[ord]` are zero. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if coefficients are calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API poly_z2a_cmplx_fft(complex_t* z, int nz, int ord, complex_t* a)
+{
+  if(!z || !a)
+    return ERROR_PTR;
+  if(nz < 0)
+    return ERROR_SIZE;
+  if(nz > ord || ord < 1)
+    return ERROR_POLY_ORD;
+
+  memset(a, 0, (ord+1) * sizeof(complex_t));
+  if(nz <= DSPL_POLY_FFT_MIN)
+    return poly_z2a_cmplx(z, nz, ord, a);
+  return poly_z2a_cmplx_tree(z, nz, a);
+}
+
+
+
+
+/*******************************************************************************
+Polynomial zeros to coefficients by the product tree.
+Zeros are split into two halves, each half is expanded recursively
+(directly if it is shorter than DSPL_POLY_FFT_MIN) and the halves
+are multiplied by FFT. Output vector `a` has nz+1 coefficients.
+*******************************************************************************/
+int poly_z2a_cmplx_tree(complex_t* z, int nz, complex_t* a)
+{
+  complex_t *t = NULL;
+  int h, err;
+
+  if(nz <= DSPL_POLY_FFT_MIN)
+    return poly_z2a_cmplx(z, nz, nz, a);
+
+  h = nz / 2;
+  t = (complex_t*)malloc((nz+2) * sizeof(complex_t));
+  if(!t)
+    return ERROR_MALLOC;
+
+  err = poly_z2a_cmplx_tree(z, h, t);
+  if(err != RES_OK)
+    goto exit_label;
+
+  err = poly_z2a_cmplx_tree(z+h, nz-h, t+h+1);
+  if(err != RES_OK)
+    goto exit_label;
+
+  err = poly_mul_cmplx_fft(t, h+1, t+h+1, nz-h+1, a);
+
+exit_label:
+  free(t);
+  return err;
+}
+
+
+
+
+/*******************************************************************************
+Complex polynomials product c = a * b by FFT.
+FFT size is the power of 2 not less than na+nb-1, so cyclic convolution
+equals to the linear one. Output vector `c` has na+nb-1 coefficients.
+*******************************************************************************/
+int poly_mul_cmplx_fft(complex_t* a, int na, complex_t* b, int nb,
+                       complex_t* c)
+{
+  fft_t pfft;
+  complex_t *pa = NULL, *pb = NULL;
+  double re, im;
+  int nfft, k, err;
+
+  nfft = 2;
+  while(nfft < na + nb - 1)
+    nfft *= 2;
+
+  memset(&pfft, 0, sizeof(fft_t));
+  pa = (complex_t*)malloc(2 * nfft * sizeof(complex_t));
+  if(!pa)
+    return ERROR_MALLOC;
+  pb = pa + nfft;
+
+  memset(pa, 0, 2 * nfft * sizeof(complex_t));
+  memcpy(pa, a, na * sizeof(complex_t));
+  memcpy(pb, b, nb * sizeof(complex_t));
+
+  err = fft_cmplx(pa, nfft, &pfft, pa);
+  if(err != RES_OK)
+    goto exit_label;
+  err = fft_cmplx(pb, nfft, &pfft, pb);
+  if(err != RES_OK)
+    goto exit_label;
+
+  for(k = 0; k < nfft; k++)
+  {
+    re = CMRE(pa[k], pb[k]);
+    im = CMIM(pa[k], pb[k]);
+    RE(pa[k]) = re;
+    IM(pa[k]) = im;
+  }
+
+  err = ifft_cmplx(pa, nfft, &pfft, pa);
+  if(err != RES_OK)
+    goto exit_label;
+
+  memcpy(c, pa, (na + nb - 1) * sizeof(complex_t));
+
+exit_label:
+  fft_free(&pfft);
+  free(pa);
+  return err;
+}
+
+
+
+
+
 /******************************************************************************
 Real polynomial roots calculation
 *******************************************************************************/
@@ -83,6 +240,7 @@ int DSPL_API polyroots(double* a, int ord, complex_t* r, int* info)
   t = (complex_t*)malloc(ord * ord * sizeof(complex_t));
   if(!t)
     return ERROR_MALLOC;
+  memset(t, 0, ord * ord * sizeof(complex_t));
   
   for(m = 0; m < ord-1; m++)
   {
@@ -93,19 +251,305 @@ int DSPL_API polyroots(double* a, int ord, complex_t* r, int* info)
 
   err = matrix_eig_cmplx(t, ord, r, info);
   
+  free(t);
   return err;
 }
 
 
 
 
+
+/******************************************************************************
+\ingroup SPEC_MATH_COMMON_GROUP
+\fn int polyroots_batch(double* a, int ord, int n, int flag,
+                        complex_t* r, int* nfb)
+\brief Batch real polynomials roots calculation
+
+Function calculates roots of `n` real polynomials of the same order
+\f$N\f$:
+\f[
+  P_k(x) = a_{k,0} + a_{k,1} x + a_{k,2}  x^2 + ... a_{k,N}  x^N,
+  \qquad k = 0 \ldots n-1.
+\f]
+
+Roots are calculated by the Aberth-Ehrlich simultaneous iterations
+without LAPACK calls and memory allocation for each polynomial.
+Iterations are stopped when the polynomial value at each root is
+below the Horner scheme rounding error bound.
+Polynomial is solved by \ref polyroots function (companion matrix
+eigenvalues) if iterations are not converged.
+
+Initial approximations are placed on the circle of radius
+\f$|a_{k,0} / a_{k,N}|^{1/N}\f$. If flag `DSPL_ROOTS_WARM` is set,
+roots vector `r` contains initial approximations, for example roots of the
+previous polynomials batch. Warm start reduces number of iterations
+for slowly varying polynomials (LPC polynomials of adjacent frames) and
+keeps roots order, so roots can be tracked from batch to batch.
+
+Polynomials are processed in parallel if the library is built with OpenMP.
+
+\param[in]  a     Pointer to the polynomials coefficients matrix. /n
+                   Coefficient \f$a_{k,m}\f$ is `a[k*(ord+1) + m]`. /n
+                   Matrix size is `[(ord+1) * n x 1]`. /n
+                   Coefficients `a[k*(ord+1) + ord]` must be nonzero. /n /n
+
+\param[in]  ord   Polynomials order \f$N\f$. /n /n
+
+\param[in]  n     Number of polynomials. /n /n
+
+\param[in]  flag  Initial approximation flag: /n
+\verbatim
+DSPL_ROOTS_COLD   initial approximations on the circle
+DSPL_ROOTS_WARM   initial approximations are taken from r
+\endverbatim
+                   /n /n
+
+\param[in,out] r  Pointer to the roots matrix. /n
+                   Root `m` of the polynomial `k` is `r[k*ord + m]`. /n
+                   Matrix size is `[ord * n x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] nfb   Pointer to the number of polynomials solved by
+                   companion matrix fallback. /n
+                   Pointer can be `NULL`. /n /n
+
+\return
+`RES_OK` if roots are calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API polyroots_batch(double* a, int ord, int n, int flag,
+                             complex_t* r, int* nfb)
+{
+  int k, cnt, err;
+
+  if(!a || !r)
+    return ERROR_PTR;
+  if(ord < 1)
+    return ERROR_POLY_ORD;
+  if(n < 1)
+    return ERROR_SIZE;
+  for(k = 0; k < n; k++)
+    if(a[k*(ord+1) + ord] == 0.0)
+      return ERROR_POLY_AN;
+
+  err = RES_OK;
+  cnt = 0;
+
+#ifdef _OPENMP
+  #pragma omp parallel if(n >= DSPL_OMP_MIN_BLOCKS)
+#endif
+  {
+    int *cnv = NULL;
+    int info, wcnt = 0, werr = RES_OK;
+
+    cnv = (int*)malloc(ord * sizeof(int));
+    if(!cnv)
+      werr = ERROR_MALLOC;
+
+#ifdef _OPENMP
+    #pragma omp for schedule(dynamic, 4)
+#endif
+    for(k = 0; k < n; k++)
+    {
+      if(werr != RES_OK)
+        continue;
+      werr = polyroots_aberth(a + k*(ord+1), ord, flag & DSPL_ROOTS_WARM,
+                              cnv, r + k*ord);
+      if(werr == DSPL_ROOTS_NOCONV)
+      {
+        werr = polyroots(a + k*(ord+1), ord, r + k*ord, &info);
+        wcnt++;
+      }
+    }
+
+#ifdef _OPENMP
+    #pragma omp critical
+#endif
+    {
+      cnt += wcnt;
+      if(werr != RES_OK)
+        err = werr;
+    }
+    if(cnv)
+      free(cnv);
+  }
+
+  if(nfb)
+    *nfb = cnt;
+  return err;
+}
+
+
+
+
+/******************************************************************************
+Aberth-Ehrlich iterations for the roots of the real polynomial `a`.
+Roots are updated in place (Gauss-Seidel manner), converged roots are
+marked in `cnv` vector and are not updated anymore.
+Returns DSPL_ROOTS_NOCONV if not all roots are converged.
+*******************************************************************************/
+int polyroots_aberth(double* a, int ord, int warm, int* cnv, complex_t* r)
+{
+  complex_t nwt, s, t, w;
+  double rad, phi, eps, den;
+  int i, j, it, nc;
+
+  if(!warm)
+  {
+    rad = pow(fabs(a[0] / a[ord]), 1.0 / (double)ord);
+    if(rad == 0.0)
+      rad = 1.0;
+    /* angle offset breaks the real axis symmetry of the initial
+       approximations which stalls iterations for real polynomials */
+    for(i = 0; i < ord; i++)
+    {
+      phi = M_2PI * (double)i / (double)ord + 0.4;
+      RE(r[i]) = rad * cos(phi);
+      IM(r[i]) = rad * sin(phi);
+    }
+  }
+
+  memset(cnv, 0, ord * sizeof(int));
+  nc = 0;
+  for(it = 0; it < DSPL_ROOTS_ITER_MAX && nc < ord; it++)
+  {
+    for(i = 0; i < ord; i++)
+    {
+      if(cnv[i])
+        continue;
+
+      polyroots_aberth_eval(a, ord, r+i, &nwt, &eps);
+      if(eps <= DSPL_ROOTS_TOL * (double)ord)
+      {
+        cnv[i] = 1;
+        nc++;
+        continue;
+      }
+
+      /* s = sum 1 / (r[i] - r[j]) */
+      RE(s) = IM(s) = 0.0;
+      for(j = 0; j < ord; j++)
+      {
+        RE(t) = RE(r[i]) - RE(r[j]);
+        IM(t) = IM(r[i]) - IM(r[j]);
+        den = ABSSQR(t);
+        if(j == i || den == 0.0)
+          continue;
+        RE(s) += RE(t) / den;
+        IM(s) -= IM(t) / den;
+      }
+
+      /* w = nwt / (1 - nwt * s) */
+      RE(t) = 1.0 - CMRE(nwt, s);
+      IM(t) =     - CMIM(nwt, s);
+      den = ABSSQR(t);
+      if(den == 0.0)
+        continue;
+      RE(w) = CMCONJRE(nwt, t) / den;
+      IM(w) = CMCONJIM(nwt, t) / den;
+
+      RE(r[i]) -= RE(w);
+      IM(r[i]) -= IM(w);
+
+      if(ABSSQR(w) <= DSPL_ROOTS_TOL * DSPL_ROOTS_TOL * ABSSQR(r[i]))
+      {
+        cnv[i] = 1;
+        nc++;
+      }
+    }
+  }
+  return (nc < ord) ? DSPL_ROOTS_NOCONV : RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Newton correction nwt = P(z) / P'(z) and relative value
+eps = |P(z)| / sum(|a[m]| |z|^m) of the real polynomial.
+Reversed polynomial is used for |z| > 1 to avoid overflow:
+P(z) = z^N Q(y), y = 1/z, P(z)/P'(z) = z Q(y) / (N Q(y) - y Q'(y)).
+Newton correction is zero if the derivative is zero.
+*******************************************************************************/
+void polyroots_aberth_eval(double* a, int ord, complex_t* z,
+                           complex_t* nwt, double* eps)
+{
+  complex_t y, p, d, t;
+  double ay, s, den, re;
+  int k;
+
+  ay = ABS(z[0]);
+  if(ay <= 1.0)
+  {
+    RE(y) = RE(z[0]);
+    IM(y) = IM(z[0]);
+    RE(p) = a[ord];
+    IM(p) = 0.0;
+    RE(d) = IM(d) = 0.0;
+    s = fabs(a[ord]);
+    for(k = ord-1; k >= 0; k--)
+    {
+      re    = CMRE(d, y) + RE(p);
+      IM(d) = CMIM(d, y) + IM(p);
+      RE(d) = re;
+      re    = CMRE(p, y) + a[k];
+      IM(p) = CMIM(p, y);
+      RE(p) = re;
+      s = s * ay + fabs(a[k]);
+    }
+    /* t = P'(z) */
+    RE(t) = RE(d);
+    IM(t) = IM(d);
+  }
+  else
+  {
+    ay = 1.0 / ay;
+    den = ABSSQR(z[0]);
+    RE(y) =  RE(z[0]) / den;
+    IM(y) = -IM(z[0]) / den;
+    RE(p) = a[0];
+    IM(p) = 0.0;
+    RE(d) = IM(d) = 0.0;
+    s = fabs(a[0]);
+    for(k = 1; k <= ord; k++)
+    {
+      re    = CMRE(d, y) + RE(p);
+      IM(d) = CMIM(d, y) + IM(p);
+      RE(d) = re;
+      re    = CMRE(p, y) + a[k];
+      IM(p) = CMIM(p, y);
+      RE(p) = re;
+      s = s * ay + fabs(a[k]);
+    }
+    /* t = (N Q(y) - y Q'(y)) / z, then nwt = Q(y) / t */
+    RE(t) = (double)ord * RE(p) - CMRE(y, d);
+    IM(t) = (double)ord * IM(p) - CMIM(y, d);
+    re    = CMRE(t, y);
+    IM(t) = CMIM(t, y);
+    RE(t) = re;
+  }
+
+  *eps = ABS(p) / s;
+  den = ABSSQR(t);
+  if(den == 0.0)
+  {
+    RE(nwt[0]) = IM(nwt[0]) = 0.0;
+    return;
+  }
+  RE(nwt[0]) = CMCONJRE(p, t) / den;
+  IM(nwt[0]) = CMCONJIM(p, t) / den;
+}
+
+
+
+
 /******************************************************************************
 Real polynomial evaluation
 *******************************************************************************/
 int DSPL_API polyval(double* a, int ord, double* x, int n, double* y)
 {
-  int k, m;
-
   if(!a || !x || !y)
     return ERROR_PTR;
   if(ord<0)
@@ -113,13 +557,7 @@ int DSPL_API polyval(double* a, int ord, double* x, int n, double* y)
   if(n<1)
     return ERROR_SIZE;
 
-  for(k = 0; k < n; k++)
-  {
-    y[k] = a[ord];
-    for(m = ord-1; m>-1; m--)
-      y[k] = y[k]*x[k] + a[m];
-  }
-  return RES_OK;
+  return polyval_krn(a, ord, x, n, y);
 }
 
 
@@ -132,9 +570,6 @@ Complex polynomial evaluation
 int DSPL_API polyval_cmplx(complex_t* a, int ord,
                            complex_t* x, int n, complex_t* y)
 {
-  int k, m;
-  complex_t t;
-
   if(!a || !x || !y)
     return ERROR_PTR;
   if(ord<0)
@@ -142,18 +577,220 @@ int DSPL_API polyval_cmplx(complex_t* a, int ord,
   if(n<1)
     return ERROR_SIZE;
 
-  for(k = 0; k < n; k++)
+  return polyval_cmplx_krn(a, ord, x, n, y);
+}
+
+
+
+
+
+/*******************************************************************************
+Real polynomial evaluation kernel (no arguments check).
+Points are processed by blocks of DSPL_POLYVAL_BLOCK values, Horner scheme
+runs across the block so the inner loop over points is vectorized and
+has no dependency between iterations. Remaining points are calculated
+by the scalar Horner scheme with the same operations order, so the result
+does not depend on the point position in the vector.
+Vector y can be the same as x.
+*******************************************************************************/
+int polyval_krn(double* a, int ord, double* x, int n, double* y)
+{
+  double t[DSPL_POLYVAL_BLOCK];
+  int k, j, m;
+
+  for(k = 0; k + DSPL_POLYVAL_BLOCK <= n; k += DSPL_POLYVAL_BLOCK)
   {
-    RE(y[k]) = RE(a[ord]);
-    IM(y[k]) = IM(a[ord]);
-    for(m = ord-1; m>-1; m--)
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+      t[j] = a[ord];
+    for(m = ord-1; m > -1; m--)
+      for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+        t[j] = t[j] * x[k+j] + a[m];
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+      y[k+j] = t[j];
+  }
+
+  for(; k < n; k++)
+  {
+    t[0] = a[ord];
+    for(m = ord-1; m > -1; m--)
+      t[0] = t[0] * x[k] + a[m];
+    y[k] = t[0];
+  }
+
+  return RES_OK;
+}
+
+
+
+
+
+/*******************************************************************************
+Real polynomial value at the single point.
+Polynomial is split to four polynomials of x^4:
+  P(x) = (P0(x^4) + x P1(x^4)) + x^2 (P2(x^4) + x P3(x^4)),
+which are calculated by four independent Horner chains and combined by the
+Estrin tree. Dependency chain is four times shorter than in the Horner
+scheme. Horner scheme is used if ord < DSPL_POLYVAL_ESTRIN_ORD.
+*******************************************************************************/
+double polyval_estrin(double* a, int ord, double x)
+{
+  double p0, p1, p2, p3, x2, x4;
+  int i, m;
+
+  if(ord < DSPL_POLYVAL_ESTRIN_ORD)
+  {
+    p0 = a[ord];
+    for(i = ord-1; i > -1; i--)
+      p0 = p0 * x + a[i];
+    return p0;
+  }
+
+  x2 = x  * x;
+  x4 = x2 * x2;
+  m  = ord / 4;
+  p0 = a[4*m];
+  p1 = (4*m+1 <= ord) ? a[4*m+1] : 0.0;
+  p2 = (4*m+2 <= ord) ? a[4*m+2] : 0.0;
+  p3 = (4*m+3 <= ord) ? a[4*m+3] : 0.0;
+  for(i = m-1; i > -1; i--)
+  {
+    p0 = p0 * x4 + a[4*i];
+    p1 = p1 * x4 + a[4*i+1];
+    p2 = p2 * x4 + a[4*i+2];
+    p3 = p3 * x4 + a[4*i+3];
+  }
+  return (p0 + x * p1) + x2 * (p2 + x * p3);
+}
+
+
+
+
+
+/*******************************************************************************
+Real coefficients polynomial evaluation at complex points kernel.
+Real and imaginary parts of the block points are kept in separate arrays
+so the Horner scheme across the block is vectorized. Remaining points are
+calculated by the scalar Horner scheme. Real coefficients save half of the
+multiplications against polyval_cmplx_krn. Vector y can be the same as x.
+*******************************************************************************/
+int polyval_re_cmplx_krn(double* a, int ord, complex_t* x, int n,
+                         complex_t* y)
+{
+  double xr[DSPL_POLYVAL_BLOCK], xi[DSPL_POLYVAL_BLOCK];
+  double tr[DSPL_POLYVAL_BLOCK], ti[DSPL_POLYVAL_BLOCK];
+  double re;
+  int k, j, m;
+
+  for(k = 0; k + DSPL_POLYVAL_BLOCK <= n; k += DSPL_POLYVAL_BLOCK)
+  {
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+    {
+      xr[j] = RE(x[k+j]);
+      xi[j] = IM(x[k+j]);
+    }
+
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+    {
+      tr[j] = a[ord];
+      ti[j] = 0.0;
+    }
+    for(m = ord-1; m > -1; m--)
+    {
+      for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+      {
+        re    = tr[j] * xr[j] - ti[j] * xi[j] + a[m];
+        ti[j] = tr[j] * xi[j] + ti[j] * xr[j];
+        tr[j] = re;
+      }
+    }
+
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+    {
+      RE(y[k+j]) = tr[j];
+      IM(y[k+j]) = ti[j];
+    }
+  }
+
+  for(; k < n; k++)
+  {
+    xr[0] = RE(x[k]);
+    xi[0] = IM(x[k]);
+    tr[0] = a[ord];
+    ti[0] = 0.0;
+    for(m = ord-1; m > -1; m--)
     {
-      RE(t) = CMRE(y[k], x[k]);
-      IM(t) = CMIM(y[k], x[k]);
-      RE(y[k]) = RE(t) + RE(a[m]);
-      IM(y[k]) = IM(t) + IM(a[m]);
+      re    = tr[0] * xr[0] - ti[0] * xi[0] + a[m];
+      ti[0] = tr[0] * xi[0] + ti[0] * xr[0];
+      tr[0] = re;
     }
+    RE(y[k]) = tr[0];
+    IM(y[k]) = ti[0];
   }
   return RES_OK;
 }
 
+
+
+
+
+/*******************************************************************************
+Complex polynomial evaluation kernel (no arguments check).
+Horner scheme across the block of DSPL_POLYVAL_BLOCK points, remaining
+points are calculated by the scalar Horner scheme.
+Vector y can be the same as x.
+*******************************************************************************/
+int polyval_cmplx_krn(complex_t* a, int ord, complex_t* x, int n,
+                      complex_t* y)
+{
+  double xr[DSPL_POLYVAL_BLOCK], xi[DSPL_POLYVAL_BLOCK];
+  double tr[DSPL_POLYVAL_BLOCK], ti[DSPL_POLYVAL_BLOCK];
+  double re;
+  int k, j, m;
+
+  for(k = 0; k + DSPL_POLYVAL_BLOCK <= n; k += DSPL_POLYVAL_BLOCK)
+  {
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+    {
+      xr[j] = RE(x[k+j]);
+      xi[j] = IM(x[k+j]);
+    }
+
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+    {
+      tr[j] = RE(a[ord]);
+      ti[j] = IM(a[ord]);
+    }
+    for(m = ord-1; m > -1; m--)
+    {
+      for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+      {
+        re    = tr[j] * xr[j] - ti[j] * xi[j] + RE(a[m]);
+        ti[j] = tr[j] * xi[j] + ti[j] * xr[j] + IM(a[m]);
+        tr[j] = re;
+      }
+    }
+
+    for(j = 0; j < DSPL_POLYVAL_BLOCK; j++)
+    {
+      RE(y[k+j]) = tr[j];
+      IM(y[k+j]) = ti[j];
+    }
+  }
+
+  for(; k < n; k++)
+  {
+    xr[0] = RE(x[k]);
+    xi[0] = IM(x[k]);
+    tr[0] = RE(a[ord]);
+    ti[0] = IM(a[ord]);
+    for(m = ord-1; m > -1; m--)
+    {
+      re    = tr[0] * xr[0] - ti[0] * xi[0] + RE(a[m]);
+      ti[0] = tr[0] * xi[0] + ti[0] * xr[0] + IM(a[m]);
+      tr[0] = re;
+    }
+    RE(y[k]) = tr[0];
+    IM(y[k]) = ti[0];
+  }
+  return RES_OK;
+}
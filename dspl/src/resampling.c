@@ -37,7 +37,7 @@ int DSPL_API farrow_lagrange(double *s, int n, double p, double q,
 {
   double a[4];
   double t, x, dt;
-  int ind, k, res;
+  int ind, k;
   double g[4];
   double *z;
 
@@ -93,16 +93,13 @@ int DSPL_API farrow_lagrange(double *s, int n, double p, double q,
     a[1] = 0.5*(z[3] - z[1])-a[3];
     a[2] = z[3] - z[2] -a[3]-a[1];
 
-    res = polyval(a, 3, &x, 1, (*y)+k);
+    (*y)[k] = ((a[3]*x + a[2])*x + a[1])*x + a[0];
 
-    if(res != RES_OK)
-      goto exit_label;
     t+=dt;
     k++;
   }
 
-exit_label:
-    return res;
+  return RES_OK;
 }
 
 
@@ -117,7 +114,7 @@ int DSPL_API farrow_spline(double *s, int n, double p, double q,
 {
   double a[4];
   double t, x, dt;
-  int ind, k, res;
+  int ind, k;
   double g[4];
   double *z;
 
@@ -173,15 +170,1955 @@ int DSPL_API farrow_spline(double *s, int n, double p, double q,
     a[3] = 2.0*(z[1] - z[2]) + a[1] + 0.5*(z[2] - z[0]);
     a[2] = z[1] - z[2] +a[3] + a[1];
 
-    res = polyval(a, 3, &x, 1, (*y)+k);
+    (*y)[k] = ((a[3]*x + a[2])*x + a[1])*x + a[0];
 
-    if(res != RES_OK)
-      goto exit_label;
     t+=dt;
     k++;
   }
 
-exit_label:
-    return res;
+  return RES_OK;
+}
+
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_decim_create(fir_decim_t* pd, double* h, int nh, int d)
+\brief Create polyphase FIR decimator object
+
+Function fills `fir_decim_t` structure for the `d` times decimation
+of the stream signal filtered by FIR filter `h`:
+\f[
+  y(m) = \sum_{k = 0}^{n_h-1} h(k)  x(md - k).
+\f]
+Filter `h` is split into `d` polyphase components
+\f$ e_p(j) = h(p + jd) \f$ which filter `d` times decimated input signal
+phases, so only output samples which are kept after decimation are
+calculated. Output sample `y(0)` corresponds to the first input sample
+`x(0)`, as for \ref decimate function.
+
+Decimator keeps filter delay line and decimation phase between
+\ref fir_decim_process (or \ref fir_decim_process_cmplx) calls,
+so the signal can be processed by blocks of any size.
+
+Antialiasing filter can be designed by \ref fir_linphase function
+with cutoff frequency `w0 = 1/d` (or less).
+
+\param[in,out] pd  Pointer to the `fir_decim_t` structure. /n
+                    Structure must be zero-initialized before the first
+                    call (for example by `memset(pd, 0, sizeof(fir_decim_t))`).
+                    Memory allocated by this function must be released by
+                    \ref fir_decim_free function. /n /n
+
+\param[in]  h      Pointer to the FIR filter impulse response. /n
+                   Vector size is `[nh x 1]`. /n /n
+
+\param[in]  nh     Filter impulse response size. /n /n
+
+\param[in]  d      Decimation factor. /n /n
+
+\return
+`RES_OK` if decimator object is created successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_decim_create(fir_decim_t* pd, double* h, int nh, int d)
+{
+  int k, p, np;
+  double *ph;
+
+  if(!pd || !h)
+    return ERROR_PTR;
+  if(nh < 1)
+    return ERROR_SIZE;
+  if(d < 1)
+    return ERROR_RESAMPLE_RATIO;
+
+  np = (nh + d - 1) / d;
+
+  if(pd->h && (pd->nh != nh || pd->d != d))
+    fir_decim_free(pd);
+
+  if(!pd->h)
+  {
+    /* polyphase filters [np x d] and delay lines [np + block x d] complex */
+    pd->h = (double*) malloc((np + 2 * (np + DSPL_RESAMPLE_BLOCK)) * d *
+                             sizeof(double));
+    if(!pd->h)
+      return ERROR_MALLOC;
+  }
+  pd->z   = pd->h + np * d;
+  pd->nh  = nh;
+  pd->np  = np;
+  pd->d   = d;
+  pd->r   = 0;
+
+  /* each polyphase component is saved in the reversed order */
+  for(p = 0; p < d; p++)
+  {
+    ph = pd->h + p * np;
+    for(k = 0; k < np; k++)
+      ph[np - 1 - k] = (p + k*d < nh) ? h[p + k*d] : 0.0;
+  }
+  memset(pd->z, 0, 2 * (np + DSPL_RESAMPLE_BLOCK) * d * sizeof(double));
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn void fir_decim_free(fir_decim_t* pd)
+\brief Release memory allocated by \ref fir_decim_create function
+
+\param[in,out] pd  Pointer to the `fir_decim_t` structure. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API fir_decim_free(fir_decim_t* pd)
+{
+  if(!pd)
+    return;
+  if(pd->h)
+    free(pd->h);
+  memset(pd, 0, sizeof(fir_decim_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_decim_process(fir_decim_t* pd, double* x, int n,
+                          double* y, int* ny)
+\brief Real signal block polyphase decimation
+
+Function filters and decimates the next block of the real stream signal.
+The same decimator object must not be used for real and complex signals
+without recreation.
+
+\param[in,out] pd  Pointer to the `fir_decim_t` structure
+                    created by \ref fir_decim_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the decimator output vector. /n
+                   Vector size is `[n/d + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if decimator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_decim_process(fir_decim_t* pd, double* x, int n,
+                               double* y, int* ny)
+{
+  double acc[DSPL_CONV_BLOCK];
+  double *z, *e, *pz, hk;
+  int d, np, ldz, i, c, p, k, j, m, i0, m0, q0, nout, len, cnt;
+
+  if(!pd || !pd->h || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  d   = pd->d;
+  np  = pd->np;
+  ldz = np + DSPL_RESAMPLE_BLOCK;
+  cnt = 0;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK * d ? n - i : DSPL_RESAMPLE_BLOCK * d;
+
+    /* input samples to the next output sample */
+    q0 = pd->r ? d - pd->r : 0;
+
+    /* split input block to the polyphase components:
+       phase p keeps samples x(md - p), new samples are saved after
+       np-1 samples of the delay line */
+    for(p = 0; p < d; p++)
+    {
+      i0 = ((q0 - p) % d + d) % d;
+      m0 = (i0 + p - q0) / d;
+      z  = pd->z + p * ldz + np - 1;
+      for(k = i0, m = m0; k < c; k += d, m++)
+        z[m] = x[i+k];
+    }
+    nout = c > q0 ? (c - q0 + d - 1) / d : 0;
+
+    /* sum of polyphase components outputs, blocked by outputs */
+    for(m = 0; m < nout; m += DSPL_CONV_BLOCK)
+    {
+      len = nout - m < DSPL_CONV_BLOCK ? nout - m : DSPL_CONV_BLOCK;
+      for(j = 0; j < len; j++)
+        acc[j] = 0.0;
+      for(p = 0; p < d; p++)
+      {
+        e  = pd->h + p * np;
+        pz = pd->z + p * ldz + m;
+        for(k = 0; k < np; k++)
+        {
+          hk = e[k];
+          for(j = 0; j < len; j++)
+            acc[j] += hk * pz[k+j];
+        }
+      }
+      memcpy(y + cnt + m, acc, len * sizeof(double));
+    }
+    cnt += nout;
+
+    /* keep np-1 delay line samples and one incomplete phase sample */
+    for(p = 0; p < d; p++)
+    {
+      z = pd->z + p * ldz;
+      memmove(z, z + nout, np * sizeof(double));
+    }
+    pd->r = (pd->r + c) % d;
+  }
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_decim_process_cmplx(fir_decim_t* pd, complex_t* x, int n,
+                                complex_t* y, int* ny)
+\brief Complex signal block polyphase decimation
+
+Function is the same as \ref fir_decim_process for the complex signal.
+Real and imaginary parts are filtered in one pass.
+
+\param[in,out] pd  Pointer to the `fir_decim_t` structure
+                    created by \ref fir_decim_create function. /n /n
+
+\param[in]  x      Pointer to the complex input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the complex decimator output vector. /n
+                   Vector size is `[n/d + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if decimator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_decim_process_cmplx(fir_decim_t* pd, complex_t* x, int n,
+                                     complex_t* y, int* ny)
+{
+  double accr[DSPL_CONV_BLOCK_CMPLX];
+  double acci[DSPL_CONV_BLOCK_CMPLX];
+  complex_t *z, *pz;
+  double *e, hk;
+  int d, np, ldz, i, c, p, k, j, m, i0, m0, q0, nout, len, cnt;
+
+  if(!pd || !pd->h || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  d   = pd->d;
+  np  = pd->np;
+  ldz = np + DSPL_RESAMPLE_BLOCK;
+  cnt = 0;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK * d ? n - i : DSPL_RESAMPLE_BLOCK * d;
+    q0 = pd->r ? d - pd->r : 0;
+
+    for(p = 0; p < d; p++)
+    {
+      i0 = ((q0 - p) % d + d) % d;
+      m0 = (i0 + p - q0) / d;
+      z  = (complex_t*)pd->z + p * ldz + np - 1;
+      for(k = i0, m = m0; k < c; k += d, m++)
+      {
+        RE(z[m]) = RE(x[i+k]);
+        IM(z[m]) = IM(x[i+k]);
+      }
+    }
+    nout = c > q0 ? (c - q0 + d - 1) / d : 0;
+
+    for(m = 0; m < nout; m += DSPL_CONV_BLOCK_CMPLX)
+    {
+      len = nout - m < DSPL_CONV_BLOCK_CMPLX ? nout - m : DSPL_CONV_BLOCK_CMPLX;
+      for(j = 0; j < len; j++)
+        accr[j] = acci[j] = 0.0;
+      for(p = 0; p < d; p++)
+      {
+        e  = pd->h + p * np;
+        pz = (complex_t*)pd->z + p * ldz + m;
+        for(k = 0; k < np; k++)
+        {
+          hk = e[k];
+          for(j = 0; j < len; j++)
+          {
+            accr[j] += hk * RE(pz[k+j]);
+            acci[j] += hk * IM(pz[k+j]);
+          }
+        }
+      }
+      for(j = 0; j < len; j++)
+      {
+        RE(y[cnt + m + j]) = accr[j];
+        IM(y[cnt + m + j]) = acci[j];
+      }
+    }
+    cnt += nout;
+
+    for(p = 0; p < d; p++)
+    {
+      z = (complex_t*)pd->z + p * ldz;
+      memmove(z, z + nout, np * sizeof(complex_t));
+    }
+    pd->r = (pd->r + c) % d;
+  }
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_interp_create(fir_interp_t* pi, double* h, int nh, int l)
+\brief Create polyphase FIR interpolator object
+
+Function fills `fir_interp_t` structure for the `l` times interpolation
+of the stream signal. Interpolator output is the same as the output of the
+FIR filter `h` for the input signal upsampled by zero stuffing:
+\f[
+  y(ml + p) = \sum_{j} h(p + jl)  x(m - j), \qquad p = 0 \ldots l-1.
+\f]
+Filter `h` is split into `l` polyphase components
+\f$ e_p(j) = h(p + jl) \f$, so inserted zeros are not multiplied
+and each input sample produces `l` output samples.
+
+Interpolator keeps filter delay line between
+\ref fir_interp_process (or \ref fir_interp_process_cmplx) calls,
+so the signal can be processed by blocks of any size.
+
+Interpolation filter can be designed by \ref fir_linphase function
+with cutoff frequency `w0 = 1/l`. Filter coefficients must be multiplied
+by `l` to keep the signal amplitude.
+
+\param[in,out] pi  Pointer to the `fir_interp_t` structure. /n
+                    Structure must be zero-initialized before the first
+                    call (for example by
+                    `memset(pi, 0, sizeof(fir_interp_t))`).
+                    Memory allocated by this function must be released by
+                    \ref fir_interp_free function. /n /n
+
+\param[in]  h      Pointer to the FIR filter impulse response. /n
+                   Vector size is `[nh x 1]`. /n /n
+
+\param[in]  nh     Filter impulse response size. /n /n
+
+\param[in]  l      Interpolation factor. /n /n
+
+\return
+`RES_OK` if interpolator object is created successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_interp_create(fir_interp_t* pi, double* h, int nh, int l)
+{
+  int k, p, np;
+  double *ph;
+
+  if(!pi || !h)
+    return ERROR_PTR;
+  if(nh < 1)
+    return ERROR_SIZE;
+  if(l < 1)
+    return ERROR_RESAMPLE_RATIO;
+
+  np = (nh + l - 1) / l;
+
+  if(pi->h && (pi->nh != nh || pi->l != l))
+    fir_interp_free(pi);
+
+  if(!pi->h)
+  {
+    /* polyphase filters [np x l] and complex delay line [np + block] */
+    pi->h = (double*) malloc((np * l + 2 * (np + DSPL_RESAMPLE_BLOCK)) *
+                             sizeof(double));
+    if(!pi->h)
+      return ERROR_MALLOC;
+  }
+  pi->z   = pi->h + np * l;
+  pi->nh  = nh;
+  pi->np  = np;
+  pi->l   = l;
+
+  /* each polyphase component is saved in the reversed order */
+  for(p = 0; p < l; p++)
+  {
+    ph = pi->h + p * np;
+    for(k = 0; k < np; k++)
+      ph[np - 1 - k] = (p + k*l < nh) ? h[p + k*l] : 0.0;
+  }
+  memset(pi->z, 0, 2 * (np + DSPL_RESAMPLE_BLOCK) * sizeof(double));
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn void fir_interp_free(fir_interp_t* pi)
+\brief Release memory allocated by \ref fir_interp_create function
+
+\param[in,out] pi  Pointer to the `fir_interp_t` structure. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API fir_interp_free(fir_interp_t* pi)
+{
+  if(!pi)
+    return;
+  if(pi->h)
+    free(pi->h);
+  memset(pi, 0, sizeof(fir_interp_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_interp_process(fir_interp_t* pi, double* x, int n, double* y)
+\brief Real signal block polyphase interpolation
+
+Function interpolates the next block of the real stream signal.
+The same interpolator object must not be used for real and complex signals
+without recreation.
+
+\param[in,out] pi  Pointer to the `fir_interp_t` structure
+                    created by \ref fir_interp_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the interpolator output vector. /n
+                   Vector size is `[n*l x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if interpolator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_interp_process(fir_interp_t* pi, double* x, int n, double* y)
+{
+  double acc[DSPL_CONV_BLOCK];
+  double *e, *pz, *py, hk;
+  int l, np, i, c, p, k, j, m, len;
+
+  if(!pi || !pi->h || !x || !y)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  l  = pi->l;
+  np = pi->np;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK ? n - i : DSPL_RESAMPLE_BLOCK;
+    memcpy(pi->z + np - 1, x + i, c * sizeof(double));
+
+    /* each polyphase component filters input signal,
+       outputs are blocked by input samples */
+    for(m = 0; m < c; m += DSPL_CONV_BLOCK)
+    {
+      len = c - m < DSPL_CONV_BLOCK ? c - m : DSPL_CONV_BLOCK;
+      pz  = pi->z + m;
+      py  = y + (i + m) * l;
+      for(p = 0; p < l; p++)
+      {
+        e = pi->h + p * np;
+        for(j = 0; j < len; j++)
+          acc[j] = 0.0;
+        for(k = 0; k < np; k++)
+        {
+          hk = e[k];
+          for(j = 0; j < len; j++)
+            acc[j] += hk * pz[k+j];
+        }
+        for(j = 0; j < len; j++)
+          py[j*l + p] = acc[j];
+      }
+    }
+    memmove(pi->z, pi->z + c, (np - 1) * sizeof(double));
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_interp_process_cmplx(fir_interp_t* pi, complex_t* x, int n,
+                                 complex_t* y)
+\brief Complex signal block polyphase interpolation
+
+Function is the same as \ref fir_interp_process for the complex signal.
+Real and imaginary parts are filtered in one pass.
+
+\param[in,out] pi  Pointer to the `fir_interp_t` structure
+                    created by \ref fir_interp_create function. /n /n
+
+\param[in]  x      Pointer to the complex input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the complex interpolator output vector. /n
+                   Vector size is `[n*l x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if interpolator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_interp_process_cmplx(fir_interp_t* pi, complex_t* x, int n,
+                                      complex_t* y)
+{
+  double accr[DSPL_CONV_BLOCK_CMPLX];
+  double acci[DSPL_CONV_BLOCK_CMPLX];
+  complex_t *z, *pz, *py;
+  double *e, hk;
+  int l, np, i, c, p, k, j, m, len;
+
+  if(!pi || !pi->h || !x || !y)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  l  = pi->l;
+  np = pi->np;
+  z  = (complex_t*)pi->z;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK ? n - i : DSPL_RESAMPLE_BLOCK;
+    memcpy(z + np - 1, x + i, c * sizeof(complex_t));
+
+    for(m = 0; m < c; m += DSPL_CONV_BLOCK_CMPLX)
+    {
+      len = c - m < DSPL_CONV_BLOCK_CMPLX ? c - m : DSPL_CONV_BLOCK_CMPLX;
+      pz  = z + m;
+      py  = y + (i + m) * l;
+      for(p = 0; p < l; p++)
+      {
+        e = pi->h + p * np;
+        for(j = 0; j < len; j++)
+          accr[j] = acci[j] = 0.0;
+        for(k = 0; k < np; k++)
+        {
+          hk = e[k];
+          for(j = 0; j < len; j++)
+          {
+            accr[j] += hk * RE(pz[k+j]);
+            acci[j] += hk * IM(pz[k+j]);
+          }
+        }
+        for(j = 0; j < len; j++)
+        {
+          RE(py[j*l + p]) = accr[j];
+          IM(py[j*l + p]) = acci[j];
+        }
+      }
+    }
+    memmove(z, z + c, (np - 1) * sizeof(complex_t));
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_resample_create(fir_resample_t* pr, int p, int q,
+                            double* h, int nh)
+\brief Create rational `p/q` polyphase resampler object
+
+Function fills `fir_resample_t` structure for the sampling frequency
+conversion by the rational factor `p/q`. Output signal is the same as
+the output of the following processing: input signal is upsampled `p` times
+by zero stuffing, filtered by FIR filter `h` and downsampled `q` times:
+\f[
+  y(n) = \sum_{k} h(k)  u(nq - k), \qquad
+  u(mp) = x(m).
+\f]
+Only polyphase component \f$ e_r(j) = h(r + jp)\f$, \f$ r = nq \mod p\f$
+is calculated for each output sample, so there are no multiplications by
+zeros and no calculations of the dropped samples.
+
+Factors `p` and `q` are reduced by their greatest common divisor.
+
+If `h` is `NULL` then filter is designed by \ref fir_linphase
+function with Kaiser window (\f$\beta = 8\f$) once in this function.
+Filter length is `32 max(p,q)` and cutoff frequency is `1/max(p,q)`
+of the upsampled signal Nyquist frequency. Relative to the lowest Nyquist
+frequency (input or output) the default filter provides passband ripple
+less than 0.001 dB up to 0.8, attenuation 6 dB at 1.0 and stopband
+attenuation more than 80 dB above 1.2. Signal delay
+is \f$ (n_h - 1) / (2p) \f$ input samples.
+
+Resampler keeps delay line and output phase between
+\ref fir_resample_process (or \ref fir_resample_process_cmplx) calls,
+so the signal can be processed by blocks of any size.
+
+\param[in,out] pr  Pointer to the `fir_resample_t` structure. /n
+                    Structure must be zero-initialized before the first
+                    call (for example by
+                    `memset(pr, 0, sizeof(fir_resample_t))`).
+                    Memory allocated by this function must be released by
+                    \ref fir_resample_free function. /n /n
+
+\param[in]  p      Interpolation factor. /n /n
+
+\param[in]  q      Decimation factor. /n /n
+
+\param[in]  h      Pointer to the FIR filter impulse response. /n
+                   Filter gain must be equal `p`. /n
+                   Vector size is `[nh x 1]`. /n
+                   Pointer can be `NULL`, then default filter is used. /n /n
+
+\param[in]  nh     Filter impulse response size. /n
+                   Parameter is ignored if `h` is `NULL`. /n /n
+
+\return
+`RES_OK` if resampler object is created successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_resample_create(fir_resample_t* pr, int p, int q,
+                                 double* h, int nh)
+{
+  double *hd = NULL, *ph;
+  int a, b, k, r, np, err;
+
+  if(!pr)
+    return ERROR_PTR;
+  if(p < 1 || q < 1)
+    return ERROR_RESAMPLE_RATIO;
+  if(h && nh < 1)
+    return ERROR_SIZE;
+
+  /* p/q ratio reduction */
+  a = p;
+  b = q;
+  while(b)
+  {
+    r = a % b;
+    a = b;
+    b = r;
+  }
+  p /= a;
+  q /= a;
+
+  if(!h)
+  {
+    nh = (p == q) ? 1 : DSPL_RESAMPLE_TAPS * (p > q ? p : q);
+    hd = (double*) malloc(nh * sizeof(double));
+    if(!hd)
+      return ERROR_MALLOC;
+    if(nh == 1)
+      hd[0] = 1.0;
+    else
+    {
+      err = fir_linphase(nh - 1, 1.0 / (double)(p > q ? p : q), 0.0,
+                         DSPL_FILTER_LPF, DSPL_WIN_KAISER,
+                         DSPL_RESAMPLE_KAISER_BETA, hd);
+      if(err != RES_OK)
+      {
+        free(hd);
+        return err;
+      }
+      for(k = 0; k < nh; k++)
+        hd[k] *= (double)p;
+    }
+    h = hd;
+  }
+
+  /* polyphase filter size is rounded up to the multiple of 4 */
+  np = (nh + p - 1) / p;
+  np = (np + 3) & ~3;
+
+  if(pr->h && (pr->np != np || pr->p != p))
+    fir_resample_free(pr);
+
+  if(!pr->h)
+  {
+    /* polyphase filters [np x p] and complex delay line [np + block] */
+    pr->h = (double*) malloc((np * p + 2 * (np + DSPL_RESAMPLE_BLOCK)) *
+                             sizeof(double));
+    if(!pr->h)
+    {
+      if(hd)
+        free(hd);
+      return ERROR_MALLOC;
+    }
+  }
+  pr->z   = pr->h + np * p;
+  pr->nh  = nh;
+  pr->np  = np;
+  pr->p   = p;
+  pr->q   = q;
+  pr->r   = 0;
+  pr->m   = 0;
+
+  /* each polyphase component is saved in the reversed order,
+     filter tail is padded by zeros */
+  for(r = 0; r < p; r++)
+  {
+    ph = pr->h + r * np;
+    for(k = 0; k < np; k++)
+      ph[np - 1 - k] = (r + k*p < nh) ? h[r + k*p] : 0.0;
+  }
+  memset(pr->z, 0, 2 * (np + DSPL_RESAMPLE_BLOCK) * sizeof(double));
+
+  if(hd)
+    free(hd);
+  return RES_OK;
 }
 
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn void fir_resample_free(fir_resample_t* pr)
+\brief Release memory allocated by \ref fir_resample_create function
+
+\param[in,out] pr  Pointer to the `fir_resample_t` structure. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API fir_resample_free(fir_resample_t* pr)
+{
+  if(!pr)
+    return;
+  if(pr->h)
+    free(pr->h);
+  memset(pr, 0, sizeof(fir_resample_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_resample_process(fir_resample_t* pr, double* x, int n,
+                             double* y, int* ny)
+\brief Real signal block rational resampling
+
+Function resamples the next block of the real stream signal.
+The same resampler object must not be used for real and complex signals
+without recreation.
+
+\param[in,out] pr  Pointer to the `fir_resample_t` structure
+                    created by \ref fir_resample_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the resampler output vector. /n
+                   Vector size is `[n*p/q + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if resampler output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_resample_process(fir_resample_t* pr, double* x, int n,
+                                  double* y, int* ny)
+{
+  double s0, s1, s2, s3;
+  double *e, *pz;
+  int np, i, c, k, m, r, cnt;
+
+  if(!pr || !pr->h || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  np  = pr->np;
+  r   = pr->r;
+  m   = pr->m;
+  cnt = 0;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK ? n - i : DSPL_RESAMPLE_BLOCK;
+    memcpy(pr->z + np - 1, x + i, c * sizeof(double));
+
+    /* output sample uses polyphase component r and input samples up to m */
+    while(m < c)
+    {
+      e  = pr->h + r * np;
+      pz = pr->z + m;
+      s0 = s1 = s2 = s3 = 0.0;
+      for(k = 0; k < np; k += 4)
+      {
+        s0 += e[k]   * pz[k];
+        s1 += e[k+1] * pz[k+1];
+        s2 += e[k+2] * pz[k+2];
+        s3 += e[k+3] * pz[k+3];
+      }
+      y[cnt++] = (s0 + s1) + (s2 + s3);
+      r += pr->q;
+      m += r / pr->p;
+      r %= pr->p;
+    }
+    m -= c;
+    memmove(pr->z, pr->z + c, (np - 1) * sizeof(double));
+  }
+  pr->r = r;
+  pr->m = m;
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int fir_resample_process_cmplx(fir_resample_t* pr, complex_t* x, int n,
+                                   complex_t* y, int* ny)
+\brief Complex signal block rational resampling
+
+Function is the same as \ref fir_resample_process for the complex signal.
+Real and imaginary parts are filtered in one pass.
+
+\param[in,out] pr  Pointer to the `fir_resample_t` structure
+                    created by \ref fir_resample_create function. /n /n
+
+\param[in]  x      Pointer to the complex input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the complex resampler output vector. /n
+                   Vector size is `[n*p/q + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if resampler output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API fir_resample_process_cmplx(fir_resample_t* pr, complex_t* x,
+                                        int n, complex_t* y, int* ny)
+{
+  double sr0, sr1, si0, si1;
+  double *e;
+  complex_t *z, *pz;
+  int np, i, c, k, m, r, cnt;
+
+  if(!pr || !pr->h || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  np  = pr->np;
+  r   = pr->r;
+  m   = pr->m;
+  z   = (complex_t*)pr->z;
+  cnt = 0;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK ? n - i : DSPL_RESAMPLE_BLOCK;
+    memcpy(z + np - 1, x + i, c * sizeof(complex_t));
+
+    while(m < c)
+    {
+      e  = pr->h + r * np;
+      pz = z + m;
+      sr0 = sr1 = si0 = si1 = 0.0;
+      for(k = 0; k < np; k += 2)
+      {
+        sr0 += e[k]   * RE(pz[k]);
+        si0 += e[k]   * IM(pz[k]);
+        sr1 += e[k+1] * RE(pz[k+1]);
+        si1 += e[k+1] * IM(pz[k+1]);
+      }
+      RE(y[cnt]) = sr0 + sr1;
+      IM(y[cnt]) = si0 + si1;
+      cnt++;
+      r += pr->q;
+      m += r / pr->p;
+      r %= pr->p;
+    }
+    m -= c;
+    memmove(z, z + c, (np - 1) * sizeof(complex_t));
+  }
+  pr->r = r;
+  pr->m = m;
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int farrow_create(farrow_t* pf, double p, double q, double frd, int type)
+\brief Create streaming Farrow resampler object
+
+Function fills `farrow_t` structure for the stream signal resampling by the
+Farrow filter with cubic Lagrange polynomials (the same as
+\ref farrow_lagrange function) or cubic splines (the same as
+\ref farrow_spline function).
+
+Resampler keeps three last input samples and the fractional time of the
+next output sample between \ref farrow_process calls, so the signal can be
+processed by blocks of any size. Resampling ratio can be changed for each
+block.
+
+\param[in,out] pf  Pointer to the `farrow_t` structure. /n
+                    Structure must be zero-initialized before the first
+                    call (for example by `memset(pf, 0, sizeof(farrow_t))`).
+                    Memory allocated by this function must be released by
+                    \ref farrow_free function. /n /n
+
+\param[in]  p      Interpolation factor. /n /n
+
+\param[in]  q      Decimation factor. /n
+                   Output sampling frequency is `p/q` of the input
+                   sampling frequency. /n /n
+
+\param[in]  frd    Fractional delay of the first output sample. /n
+                   Parameter must be in `(-1, 1)` range. /n /n
+
+\param[in]  type   Interpolation polynomials type: /n
+\verbatim
+DSPL_FARROW_LAGRANGE   - cubic Lagrange polynomials
+DSPL_FARROW_SPLINE     - cubic splines
+\endverbatim
+/n
+
+\return
+`RES_OK` if resampler object is created successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API farrow_create(farrow_t* pf, double p, double q,
+                           double frd, int type)
+{
+  if(!pf)
+    return ERROR_PTR;
+  if(p <= 0.0 || q <= 0.0)
+    return ERROR_RESAMPLE_RATIO;
+  if(frd <= -1.0 || frd >= 1.0)
+    return ERROR_RESAMPLE_FRAC_DELAY;
+  if(type != DSPL_FARROW_LAGRANGE && type != DSPL_FARROW_SPLINE)
+    return ERROR_FARROW_TYPE;
+
+  if(!pf->z)
+  {
+    pf->z = (double*) malloc((DSPL_FARROW_HIST + DSPL_RESAMPLE_BLOCK) *
+                             sizeof(double));
+    if(!pf->z)
+      return ERROR_MALLOC;
+  }
+  memset(pf->z, 0, DSPL_FARROW_HIST * sizeof(double));
+
+  /* delay line keeps 3 last input samples, so the first input sample
+     time is 3 */
+  pf->t    = (double)DSPL_FARROW_HIST - frd;
+  pf->dt   = q / p;
+  pf->type = type;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn void farrow_free(farrow_t* pf)
+\brief Release memory allocated by \ref farrow_create function
+
+\param[in,out] pf  Pointer to the `farrow_t` structure. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API farrow_free(farrow_t* pf)
+{
+  if(!pf)
+    return;
+  if(pf->z)
+    free(pf->z);
+  memset(pf, 0, sizeof(farrow_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int farrow_process(farrow_t* pf, double* x, int n, double p, double q,
+                       double* y, int* ny)
+\brief Streaming Farrow resampling of the real signal block
+
+Function resamples the next block of the stream signal. Resampling ratio
+`p/q` is the ratio at the end of the current block. Time step between
+output samples changes linearly from the previous block ratio to the
+new ratio, so the clock drift can be corrected smoothly without phase jumps.
+
+Output sample is calculated when two input samples after its time are
+available, so the last output samples of the block are calculated
+when the next block is processed. Output samples are the same as
+\ref farrow_lagrange and \ref farrow_spline functions output for the
+constant ratio.
+
+\param[in,out] pf  Pointer to the `farrow_t` structure
+                    created by \ref farrow_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[in]  p      Interpolation factor at the end of the block. /n /n
+
+\param[in]  q      Decimation factor at the end of the block. /n /n
+
+\param[out] y      Pointer to the resampler output vector. /n
+                   Vector size is `[n*r + 1 x 1]`, here `r` is maximal
+                   of the previous and the new `p/q` ratios. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if resampler output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API farrow_process(farrow_t* pf, double* x, int n, double p,
+                            double q, double* y, int* ny)
+{
+  int    ind[DSPL_RESAMPLE_BLOCK];
+  double fr[DSPL_RESAMPLE_BLOCK];
+  double *z, *s, t, dt0, ddt, a0, a1, a2, a3;
+  int i, c, k, m, cnt;
+
+  if(!pf || !pf->z || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+  if(p <= 0.0 || q <= 0.0)
+    return ERROR_RESAMPLE_RATIO;
+
+  z   = pf->z;
+  t   = pf->t;
+  dt0 = pf->dt;
+  ddt = (q / p - dt0) / (double)n;
+  cnt = 0;
+  for(i = 0; i < n; i += c)
+  {
+    c = n - i < DSPL_RESAMPLE_BLOCK ? n - i : DSPL_RESAMPLE_BLOCK;
+    memcpy(z + DSPL_FARROW_HIST, x + i, c * sizeof(double));
+
+    /* output sample at time t uses samples z[k-1] ... z[k+2], k = floor(t),
+       so t < c + 1 */
+    while(t < (double)(c + 1))
+    {
+      /* output samples time calculation */
+      m = 0;
+      while(t < (double)(c + 1) && m < DSPL_RESAMPLE_BLOCK)
+      {
+        k = (int)t;
+        ind[m] = k - 1;
+        fr[m]  = t - (double)k - 1.0;
+        t += dt0 + ddt * ((double)i + t - (double)DSPL_FARROW_HIST);
+        m++;
+      }
+
+      /* Farrow filter coefficients and Horner polynomial evaluation */
+      if(pf->type == DSPL_FARROW_LAGRANGE)
+      {
+        for(k = 0; k < m; k++)
+        {
+          s  = z + ind[k];
+          a0 = s[2];
+          a3 = DSPL_FARROW_LAGRANGE_COEFF*(s[3] - s[0]) + 0.5*(s[1] - s[2]);
+          a1 = 0.5*(s[3] - s[1]) - a3;
+          a2 = s[3] - s[2] - a3 - a1;
+          y[cnt+k] = ((a3 * fr[k] + a2) * fr[k] + a1) * fr[k] + a0;
+        }
+      }
+      else
+      {
+        for(k = 0; k < m; k++)
+        {
+          s  = z + ind[k];
+          a0 = s[2];
+          a1 = 0.5*(s[3] - s[1]);
+          a3 = 2.0*(s[1] - s[2]) + a1 + 0.5*(s[2] - s[0]);
+          a2 = s[1] - s[2] + a3 + a1;
+          y[cnt+k] = ((a3 * fr[k] + a2) * fr[k] + a1) * fr[k] + a0;
+        }
+      }
+      cnt += m;
+    }
+    t -= (double)c;
+    memmove(z, z + c, DSPL_FARROW_HIST * sizeof(double));
+  }
+  pf->t  = t;
+  pf->dt = q / p;
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int cic_create(cic_t* pc, int r, int m, int nst)
+\brief Create CIC decimator or interpolator object
+
+Function fills `cic_t` structure of the cascaded integrator-comb (CIC)
+filter with transfer function
+\f[
+  H(z) = \left(\frac{1 - z^{-rm}}{1 - z^{-1}} \right)^{N},
+\f]
+here `r` is decimation (interpolation) factor, `m` is comb differential
+delay and \f$N\f$ is number of stages `nst`.
+The same object is used for decimation by \ref cic_decim_process function
+or for interpolation by \ref cic_interp_process function.
+
+CIC filter contains no multiplications. Integrators and combs use 64 bits
+integer accumulators with modular arithmetic, so integrators overflow
+does not corrupt the output. Input signal \f$|x| \leq 1\f$ is quantized
+to \f$ b = 62 - \lceil N \log_2(rm) \rceil \f$ fractional bits
+(but not more than 52), and the output is normalized to unit DC gain.
+
+CIC filter passband droop can be compensated by the FIR filter
+designed by \ref cic_comp_fir function.
+
+\param[in,out] pc  Pointer to the `cic_t` structure. /n
+                    Structure must be zero-initialized before the first
+                    call (for example by `memset(pc, 0, sizeof(cic_t))`).
+                    Memory allocated by this function must be released by
+                    \ref cic_free function. /n /n
+
+\param[in]  r      Decimation or interpolation factor. /n /n
+
+\param[in]  m      Comb differential delay (usually 1 or 2). /n /n
+
+\param[in]  nst    Number of integrator and comb stages. /n /n
+
+\return
+`RES_OK` if CIC object is created successfully. /n
+`ERROR_CIC_BITS` if input signal quantization is less than 16 bits. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API cic_create(cic_t* pc, int r, int m, int nst)
+{
+  double g;
+  int b;
+
+  if(!pc)
+    return ERROR_PTR;
+  if(r < 1)
+    return ERROR_RESAMPLE_RATIO;
+  if(m < 1 || nst < 1)
+    return ERROR_SIZE;
+
+  /* register bits growth */
+  g = (double)nst * log2((double)r * (double)m);
+  b = DSPL_CIC_ACC_BITS - (int)ceil(g - 1E-9);
+  if(b > DSPL_CIC_MAX_BITS)
+    b = DSPL_CIC_MAX_BITS;
+  if(b < DSPL_CIC_MIN_BITS)
+    return ERROR_CIC_BITS;
+
+  if(pc->acc && (pc->m != m || pc->nst != nst))
+    cic_free(pc);
+
+  if(!pc->acc)
+  {
+    /* integrators [nst] and comb delay lines [m x nst] */
+    pc->acc = (unsigned long long*) malloc((m + 1) * nst *
+                                           sizeof(unsigned long long));
+    if(!pc->acc)
+      return ERROR_MALLOC;
+  }
+  memset(pc->acc, 0, (m + 1) * nst * sizeof(unsigned long long));
+
+  pc->sc  = ldexp(1.0, b);
+  pc->g   = 1.0 / (pc->sc * pow((double)r * (double)m, (double)nst));
+  pc->r   = r;
+  pc->m   = m;
+  pc->nst = nst;
+  pc->cnt = 0;
+  pc->ind = 0;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn void cic_free(cic_t* pc)
+\brief Release memory allocated by \ref cic_create function
+
+\param[in,out] pc  Pointer to the `cic_t` structure. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API cic_free(cic_t* pc)
+{
+  if(!pc)
+    return;
+  if(pc->acc)
+    free(pc->acc);
+  memset(pc, 0, sizeof(cic_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int cic_decim_process(cic_t* pc, double* x, int n, double* y, int* ny)
+\brief CIC decimation of the real signal block
+
+Function processes the next block of the stream signal by CIC decimator.
+Integrators run at the input sampling frequency, combs run at the output
+sampling frequency. Output sample `y(0)` corresponds to the input sample
+`x(r-1)`. Integrators, combs and decimation phase are kept between calls.
+
+\param[in,out] pc  Pointer to the `cic_t` structure
+                    created by \ref cic_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the CIC decimator output vector. /n
+                   Vector size is `[n/r + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if CIC decimator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API cic_decim_process(cic_t* pc, double* x, int n,
+                               double* y, int* ny)
+{
+  unsigned long long *acc, *dl, v, t;
+  int i, s, nst, cnt;
+
+  if(!pc || !pc->acc || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  nst = pc->nst;
+  acc = pc->acc;
+  dl  = pc->acc + nst;
+  cnt = 0;
+  for(i = 0; i < n; i++)
+  {
+    /* integrators */
+    acc[0] += (unsigned long long)llrint(x[i] * pc->sc);
+    for(s = 1; s < nst; s++)
+      acc[s] += acc[s-1];
+
+    if(++pc->cnt < pc->r)
+      continue;
+    pc->cnt = 0;
+
+    /* combs at the output sampling frequency */
+    v = acc[nst-1];
+    for(s = 0; s < nst; s++)
+    {
+      t = dl[pc->ind * nst + s];
+      dl[pc->ind * nst + s] = v;
+      v -= t;
+    }
+    pc->ind = (pc->ind + 1) % pc->m;
+    y[cnt++] = (double)(long long)v * pc->g;
+  }
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int cic_interp_process(cic_t* pc, double* x, int n, double* y)
+\brief CIC interpolation of the real signal block
+
+Function processes the next block of the stream signal by CIC interpolator.
+Combs run at the input sampling frequency, then the signal is upsampled
+by zero stuffing and integrators run at the output sampling frequency.
+Each input sample produces `r` output samples.
+Integrators and combs are kept between calls.
+
+\param[in,out] pc  Pointer to the `cic_t` structure
+                    created by \ref cic_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the CIC interpolator output vector. /n
+                   Vector size is `[n*r x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if CIC interpolator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API cic_interp_process(cic_t* pc, double* x, int n, double* y)
+{
+  unsigned long long *acc, *dl, v, t;
+  double g;
+  int i, k, s, nst;
+
+  if(!pc || !pc->acc || !x || !y)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  nst = pc->nst;
+  acc = pc->acc;
+  dl  = pc->acc + nst;
+  /* interpolator gain is (rm)^N / r */
+  g = pc->g * (double)pc->r;
+  for(i = 0; i < n; i++)
+  {
+    /* combs at the input sampling frequency */
+    v = (unsigned long long)llrint(x[i] * pc->sc);
+    for(s = 0; s < nst; s++)
+    {
+      t = dl[pc->ind * nst + s];
+      dl[pc->ind * nst + s] = v;
+      v -= t;
+    }
+    pc->ind = (pc->ind + 1) % pc->m;
+
+    /* integrators at the output sampling frequency, zero stuffed input */
+    for(k = 0; k < pc->r; k++)
+    {
+      acc[0] += v;
+      v = 0;
+      for(s = 1; s < nst; s++)
+        acc[s] += acc[s-1];
+      y[i * pc->r + k] = (double)(long long)acc[nst-1] * g;
+    }
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int cic_comp_fir(int r, int m, int nst, int ord, double wp,
+                     int win_type, double win_param, double* h)
+\brief CIC filter compensation FIR design
+
+Function designs linear phase FIR filter which compensates the CIC filter
+passband droop. Filter works at the CIC decimator output sampling frequency
+(or CIC interpolator input sampling frequency). Filter is designed by the
+window method like \ref fir_linphase function, but the desired passband
+magnitude response is the inverse CIC response:
+\f[
+  D(\omega) = \left| \frac{rm \sin(\omega / (2r))}
+  {\sin(\omega m / 2)} \right|^{N}, \qquad 0 \leq \omega < \pi w_p,
+\f]
+and \f$D(\omega) = 0\f$ in the stopband. Filter DC gain is 1.
+Desired response is limited by 60 dB near the CIC response null.
+
+CIC decimator followed by the compensation FIR decimator
+(see \ref fir_decim_create) with `wp = 0.5` makes
+CIC + 2 times FIR decimation chain.
+
+\param[in]  r      CIC decimation or interpolation factor. /n /n
+
+\param[in]  m      CIC comb differential delay. /n /n
+
+\param[in]  nst    Number of CIC stages. /n /n
+
+\param[in]  ord    Compensation filter order. /n
+                   Filter length is `ord + 1`. /n /n
+
+\param[in]  wp     Compensation filter cutoff frequency normalized to the
+                   CIC output Nyquist frequency. /n
+                   Must be in `(0, 1]` range and less than `2 / m`
+                   (the first CIC response null), else
+                   `ERROR_FILTER_WP` is returned. /n /n
+
+\param[in]  win_type   Window function type (see \ref window). /n /n
+
+\param[in]  win_param  Window function parameter. /n /n
+
+\param[out] h      Pointer to the compensation filter impulse response. /n
+                   Vector size is `[ord + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if filter is designed successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API cic_comp_fir(int r, int m, int nst, int ord, double wp,
+                          int win_type, double win_param, double* h)
+{
+  double *w = NULL, *d = NULL;
+  double dw, om, s, c, del;
+  int k, n, ng, err;
+
+  if(!h)
+    return ERROR_PTR;
+  if(r < 1 || m < 1 || nst < 1)
+    return ERROR_SIZE;
+  if(ord < 1)
+    return ERROR_FILTER_ORD;
+  if(wp <= 0.0 || wp > 1.0)
+    return ERROR_FILTER_WP;
+  /* passband must not reach the first CIC null at 2 / m,
+     inverse CIC response is unbounded there */
+  if(wp * (double)m >= 2.0)
+    return ERROR_FILTER_WP;
+
+  /* desired response on the passband frequency grid (trapezoidal rule) */
+  ng = DSPL_CIC_COMP_GRID * (ord + 1);
+  w = (double*) malloc((ord + 1) * sizeof(double));
+  d = (double*) malloc((ng + 1) * sizeof(double));
+  if(!w || !d)
+  {
+    err = ERROR_MALLOC;
+    goto exit_label;
+  }
+  dw = M_PI * wp / (double)ng;
+  d[0] = 1.0;
+  for(k = 1; k <= ng; k++)
+  {
+    om = dw * (double)k;
+    c  = sin(0.5 * om * (double)m);
+    s  = (double)r * (double)m * sin(0.5 * om / (double)r);
+    d[k] = (fabs(c) * DSPL_CIC_COMP_GAIN_MAX > fabs(s)) ?
+            pow(fabs(s / c), (double)nst) : DSPL_CIC_COMP_GAIN_MAX;
+    if(d[k] > DSPL_CIC_COMP_GAIN_MAX)
+      d[k] = DSPL_CIC_COMP_GAIN_MAX;
+  }
+  d[0]  *= 0.5;
+  d[ng] *= 0.5;
+
+  /* ideal impulse response of the inverse CIC lowpass filter */
+  del = 0.5 * (double)ord;
+  for(n = 0; n < ord + 1; n++)
+  {
+    s = 0.0;
+    for(k = 0; k <= ng; k++)
+      s += d[k] * cos(dw * (double)k * ((double)n - del));
+    h[n] = s * dw / M_PI;
+  }
+
+  err = window(w, ord + 1, win_type | DSPL_SYMMETRIC, win_param);
+  if(err != RES_OK)
+    goto exit_label;
+
+  /* windowing and unit DC gain normalization */
+  s = 0.0;
+  for(n = 0; n < ord + 1; n++)
+  {
+    h[n] *= w[n];
+    s += h[n];
+  }
+  for(n = 0; n < ord + 1; n++)
+    h[n] /= s;
+
+exit_label:
+  if(w)
+    free(w);
+  if(d)
+    free(d);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int halfband_plan(int d, double wp, double rs, int* ord, int* nst)
+\brief Multistage half-band decimator (interpolator) design planner
+
+Function calculates number of half-band 2 times decimation stages and
+the order of each stage filter for decimation by factor `d`.
+Stage `k` (stages are numbered from the highest sampling frequency)
+must keep passband \f$ w_p 2^{k - N}\f$ (normalized to the stage input
+Nyquist frequency) and reject the components which alias to the passband,
+so the first stages have wide transition band and low order, and the last
+stage has the narrowest transition band. Filter orders are estimated for
+Kaiser window with stopband attenuation `rs`:
+\f[
+  n_k = \frac{r_s - 7.95}{7.18 (1 - 2^{k - N + 1} w_p)},
+\f]
+and rounded up to `4K + 2`.
+
+\param[in]  d      Decimation factor. /n
+                   Must be power of 2 not more than
+                   `2^DSPL_HALFBAND_STAGES_MAX`. /n /n
+
+\param[in]  wp     Passband edge normalized to the output
+                   Nyquist frequency. /n
+                   Must be in `(0, 1)` range. /n /n
+
+\param[in]  rs     Stopband attenuation (dB). /n /n
+
+\param[out] ord    Pointer to the stages filters orders vector. /n
+                   Vector size is `[DSPL_HALFBAND_STAGES_MAX x 1]`. /n /n
+
+\param[out] nst    Pointer to the number of stages. /n /n
+
+\return
+`RES_OK` if design plan is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API halfband_plan(int d, double wp, double rs, int* ord, int* nst)
+{
+  double tw;
+  int k, n, o;
+
+  if(!ord || !nst)
+    return ERROR_PTR;
+  if(wp <= 0.0 || wp >= 1.0)
+    return ERROR_FILTER_WP;
+  if(rs <= 0.0)
+    return ERROR_FILTER_RS;
+
+  n = 0;
+  while((1 << n) < d && n < DSPL_HALFBAND_STAGES_MAX)
+    n++;
+  if(d < 2 || (1 << n) != d)
+    return ERROR_RESAMPLE_RATIO;
+
+  for(k = 0; k < n; k++)
+  {
+    /* transition band width normalized to the stage input Nyquist */
+    tw = 1.0 - wp * ldexp(1.0, k - n + 1);
+    o = (int)ceil((rs - 7.95) / (7.18 * tw));
+    if(o < 2)
+      o = 2;
+    ord[k] = ((o + 1) / 4) * 4 + 2;
+    if(ord[k] - 4 >= o)
+      ord[k] -= 4;
+  }
+  *nst = n;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int halfband_create(halfband_t* ph, int d, double wp, double rs)
+\brief Create multistage half-band decimator or interpolator object
+
+Function plans the cascade of 2 times half-band stages for decimation or
+interpolation by factor `d` by \ref halfband_plan function and designs
+each stage filter by \ref fir_halfband function with Kaiser window.
+Only nonzero symmetric taps are saved, so each 2 times stage calculates
+about `ord/4 + 1` multiplications per output sample.
+
+The same object is used for decimation by \ref halfband_decim_process
+function or for interpolation by \ref halfband_interp_process function.
+Interpolator stages are applied in the reversed order (the highest order
+stage works at the lowest sampling frequency).
+
+\param[in,out] ph  Pointer to the `halfband_t` structure. /n
+                    Structure must be zero-initialized before the first
+                    call (for example by `memset(ph, 0, sizeof(halfband_t))`).
+                    Memory allocated by this function must be released by
+                    \ref halfband_free function. /n /n
+
+\param[in]  d      Decimation (interpolation) factor. /n
+                   Must be power of 2. /n /n
+
+\param[in]  wp     Passband edge normalized to the low sampling
+                   frequency Nyquist frequency. /n /n
+
+\param[in]  rs     Stopband attenuation (dB). /n /n
+
+\return
+`RES_OK` if object is created successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API halfband_create(halfband_t* ph, int d, double wp, double rs)
+{
+  int ord[DSPL_HALFBAND_STAGES_MAX];
+  double *h = NULL, *g;
+  int k, j, nst, ng, nz, err;
+
+  if(!ph)
+    return ERROR_PTR;
+  err = halfband_plan(d, wp, rs, ord, &nst);
+  if(err != RES_OK)
+    return err;
+
+  ng = nz = 0;
+  for(k = 0; k < nst; k++)
+  {
+    ng += ord[k] / 4 + 1;
+    nz += ord[k] + DSPL_HALFBAND_BLOCK + 1;
+  }
+
+  halfband_free(ph);
+  ph->g = (double*) malloc((ng + nz) * sizeof(double));
+  h = (double*) malloc((ord[nst-1] + 1) * sizeof(double));
+  if(!ph->g || !h)
+  {
+    err = ERROR_MALLOC;
+    goto exit_label;
+  }
+  ph->z = ph->g + ng;
+  memset(ph->z, 0, nz * sizeof(double));
+
+  /* nonzero half of the even taps of each stage */
+  g = ph->g;
+  for(k = 0; k < nst; k++)
+  {
+    err = fir_halfband(ord[k], DSPL_WIN_KAISER, fir_kaiser_beta(rs), h);
+    if(err != RES_OK)
+      goto exit_label;
+    for(j = 0; j < ord[k] / 4 + 1; j++)
+      g[j] = h[2*j];
+    g += ord[k] / 4 + 1;
+    ph->ord[k] = ord[k];
+    ph->r[k] = 0;
+  }
+  ph->nst = nst;
+
+exit_label:
+  if(h)
+    free(h);
+  if(err != RES_OK)
+    halfband_free(ph);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn void halfband_free(halfband_t* ph)
+\brief Release memory allocated by \ref halfband_create function
+
+\param[in,out] ph  Pointer to the `halfband_t` structure. /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+void DSPL_API halfband_free(halfband_t* ph)
+{
+  if(!ph)
+    return;
+  if(ph->g)
+    free(ph->g);
+  memset(ph, 0, sizeof(halfband_t));
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int halfband_decim_process(halfband_t* ph, double* x, int n,
+                               double* y, int* ny)
+\brief Multistage half-band decimation of the real signal block
+
+Function processes the next block of the stream signal by the cascade of
+2 times half-band decimators. Each stage output is written directly to the
+next stage delay line. Output sample `y(0)` corresponds to the input
+sample `x(0)`. Delay lines and decimation phases are kept between calls.
+
+\param[in,out] ph  Pointer to the `halfband_t` structure
+                    created by \ref halfband_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the decimator output vector. /n
+                   Vector size is `[n/d + 1 x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\param[out] ny     Pointer to the number of output samples
+                   calculated for the current block. /n /n
+
+\return
+`RES_OK` if decimator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API halfband_decim_process(halfband_t* ph, double* x, int n,
+                                    double* y, int* ny)
+{
+  double *g, *z, *out;
+  int i, b, c, s, nc, cnt;
+
+  if(!ph || !ph->g || !x || !y || !ny)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  cnt = 0;
+  for(i = 0; i < n; i += b)
+  {
+    b = n - i < DSPL_HALFBAND_BLOCK ? n - i : DSPL_HALFBAND_BLOCK;
+    memcpy(ph->z + ph->ord[0], x + i, b * sizeof(double));
+
+    g = ph->g;
+    z = ph->z;
+    c = b;
+    for(s = 0; s < ph->nst && c > 0; s++)
+    {
+      /* stage output goes to the next stage delay line or to the output */
+      out = (s < ph->nst - 1) ?
+            z + ph->ord[s] + DSPL_HALFBAND_BLOCK + 1 + ph->ord[s+1] :
+            y + cnt;
+      nc = halfband_decim_krn(g, ph->ord[s], z, c, ph->r[s], out);
+      memmove(z, z + c, ph->ord[s] * sizeof(double));
+      ph->r[s] = (ph->r[s] + c) % 2;
+
+      g += ph->ord[s] / 4 + 1;
+      z += ph->ord[s] + DSPL_HALFBAND_BLOCK + 1;
+      c = nc;
+    }
+    cnt += c;
+  }
+  *ny = cnt;
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+\ingroup RESAMPLING_GROUP
+\fn int halfband_interp_process(halfband_t* ph, double* x, int n, double* y)
+\brief Multistage half-band interpolation of the real signal block
+
+Function processes the next block of the stream signal by the cascade of
+2 times half-band interpolators. Stages are applied in the reversed order
+relative to the decimator. Each input sample produces `d` output samples.
+Delay lines are kept between calls.
+
+\param[in,out] ph  Pointer to the `halfband_t` structure
+                    created by \ref halfband_create function. /n /n
+
+\param[in]  x      Pointer to the input signal block. /n
+                   Vector size is `[n x 1]`. /n /n
+
+\param[in]  n      Input signal block size. /n /n
+
+\param[out] y      Pointer to the interpolator output vector. /n
+                   Vector size is `[n*d x 1]`. /n
+                   Memory must be allocated. /n /n
+
+\return
+`RES_OK` if interpolator output is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error". /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API halfband_interp_process(halfband_t* ph, double* x, int n,
+                                     double* y)
+{
+  double *g[DSPL_HALFBAND_STAGES_MAX], *z[DSPL_HALFBAND_STAGES_MAX];
+  double *out;
+  int i, c, b, s, nst;
+
+  if(!ph || !ph->g || !x || !y)
+    return ERROR_PTR;
+  if(n < 1)
+    return ERROR_SIZE;
+
+  nst = ph->nst;
+  g[0] = ph->g;
+  z[0] = ph->z;
+  for(s = 1; s < nst; s++)
+  {
+    g[s] = g[s-1] + ph->ord[s-1] / 4 + 1;
+    z[s] = z[s-1] + ph->ord[s-1] + DSPL_HALFBAND_BLOCK + 1;
+  }
+
+  /* input block size, so the first stage output fits the block */
+  b = DSPL_HALFBAND_BLOCK >> nst;
+  if(b < 1)
+    b = 1;
+  for(i = 0; i < n; i += b)
+  {
+    c = n - i < b ? n - i : b;
+    s = nst - 1;
+    memcpy(z[s] + ph->ord[s] / 2, x + i, c * sizeof(double));
+    for(; s >= 0; s--)
+    {
+      out = s ? z[s-1] + ph->ord[s-1] / 2 : y + i * (1 << nst);
+      halfband_interp_krn(g[s], ph->ord[s], z[s], c, out);
+      memmove(z[s], z[s] + c, (ph->ord[s] / 2) * sizeof(double));
+      c *= 2;
+    }
+  }
+  return RES_OK;
+}
+
+
+
+
+/******************************************************************************
+Half-band 2 times decimator kernel.
+Filter order is `ord = 4K+2`, `g` keeps K+1 nonzero taps h(0), h(2), ..., 
+h(2K), central tap is 0.5. Delay line `z` keeps `ord` previous input
+samples and `n` new input samples. Output is calculated for input samples
+`k` with the parity `r` (k + r is even). Symmetric taps samples are added
+before multiplication. Function returns number of output samples.
+*******************************************************************************/
+int halfband_decim_krn(double* g, int ord, double* z, int n, int r,
+                       double* y)
+{
+  double acc[DSPL_CONV_BLOCK];
+  double *pz, gj;
+  int m, j, t, len, nout, nq, c;
+
+  nq = ord / 4 + 1;
+  c  = ord / 2;
+  nout = n > r ? (n - r + 1) / 2 : 0;
+  for(m = 0; m < nout; m += DSPL_CONV_BLOCK)
+  {
+    len = nout - m < DSPL_CONV_BLOCK ? nout - m : DSPL_CONV_BLOCK;
+    /* output t uses z[k] ... z[k + ord], k = r + 2(m + t) */
+    pz = z + r + 2 * m;
+    for(t = 0; t < len; t++)
+      acc[t] = 0.5 * pz[2*t + c];
+    for(j = 0; j < nq; j++)
+    {
+      gj = g[j];
+      for(t = 0; t < len; t++)
+        acc[t] += gj * (pz[2*t + 2*j] + pz[2*t + ord - 2*j]);
+    }
+    memcpy(y + m, acc, len * sizeof(double));
+  }
+  return nout;
+}
+
+
+
+
+/******************************************************************************
+Half-band 2 times interpolator kernel.
+Delay line `z` keeps `ord/2` previous input samples and `n` new input
+samples. Even output samples use nonzero symmetric taps `g`,
+odd output samples are delayed input samples (central tap).
+Interpolator gain is 2.
+*******************************************************************************/
+int halfband_interp_krn(double* g, int ord, double* z, int n, double* y)
+{
+  double acc[DSPL_CONV_BLOCK];
+  double *pz, gj;
+  int m, j, t, len, nq, c;
+
+  nq = ord / 4 + 1;
+  c  = ord / 2;
+  for(m = 0; m < n; m += DSPL_CONV_BLOCK)
+  {
+    len = n - m < DSPL_CONV_BLOCK ? n - m : DSPL_CONV_BLOCK;
+    /* input sample t is z[c + m + t] */
+    pz = z + m;
+    for(t = 0; t < len; t++)
+      acc[t] = 0.0;
+    for(j = 0; j < nq; j++)
+    {
+      gj = g[j];
+      for(t = 0; t < len; t++)
+        acc[t] += gj * (pz[t + c - j] + pz[t + j]);
+    }
+    for(t = 0; t < len; t++)
+    {
+      y[2*(m+t)]   = 2.0 * acc[t];
+      y[2*(m+t)+1] = pz[t + (c + 1) / 2];
+    }
+  }
+  return RES_OK;
+}
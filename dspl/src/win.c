@@ -512,7 +512,7 @@ int win_kaiser(double* w, int n, int win_type, double param)
     return err;
   for(i = 0; i < n; i++)
   {
-    y = (double)(2*i) / x - 1.0;
+    y = (double)(2*i) * x - 1.0;
     y = param * sqrt(1.0 - y*y);
     err = bessel_i0(&y, 1, &num);
     if(err != RES_OK)
@@ -0,0 +1,465 @@
+/*
+* Copyright (c) 2015-2019 Sergey Bakhurin
+* Digital Signal Processing Library [http://dsplib.org]
+*
+* This file is part of libdspl-2.0.
+*
+* is free software: you can redistribute it and/or modify
+* it under the terms of the GNU Lesser  General Public License as published by
+* the Free Software Foundation, either version 3 of the License, or
+* (at your option) any later version.
+*
+* DSPL is distributed in the hope that it will be useful,
+* but WITHOUT ANY WARRANTY; without even the implied warranty of
+* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+* GNU General Public License for more details.
+*
+* You should have received a copy of the GNU Lesser General Public License
+* along with Foobar.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+#include "dspl_internal.h"
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int autocorr(double* x, int nx, int flag, int nr,
+                 fft_t* pfft, double* r, double* t)
+\brief Real vector autocorrelation function by using FFT
+
+Function calculates autocorrelation of the real vector `x`
+\f[
+  r(k) = \sum_{n} x(n+k) x(n), \qquad k = -n_r \ldots n_r
+\f]
+in the frequency domain as inverse FFT of the vector power spectrum.
+FFT size is the minimal power of 2 which provides
+lags `-nr ... nr` without circular aliasing.
+
+\param[in]  x     Pointer to the input vector `x`. /n
+                  Vector size is `[nx x 1]`. /n /n
+
+\param[in]  nx    Size of the input vector `x`. /n /n
+
+\param[in]  flag  Autocorrelation scaling: /n
+\verbatim
+DSPL_XCORR_NOSCALE     no scaling
+DSPL_XCORR_BIASED      r(k) / nx
+DSPL_XCORR_UNBIASED    r(k) / (nx - |k|)
+DSPL_XCORR_NORMALIZED  r(k) / r(0)
+\endverbatim
+
+\param[in]  nr    Maximal lag. /n
+                  Lags `-nr ... nr` are calculated. /n /n
+
+\param[in]  pfft  Pointer to the structure `fft_t`. /n
+                  Function changes `fft_t` structure fields so `fft_t` must
+                  be clear before program returns. /n /n
+
+\param[out] r     Pointer to the autocorrelation vector. /n
+                  Vector size is `[2*nr+1 x 1]`. /n
+                  `r[nr]` corresponds to zero lag. /n
+                  Memory must be allocated. /n /n
+
+\param[out] t     Pointer to the lag vector `-nr ... nr`. /n
+                  Vector size is `[2*nr+1 x 1]`. /n
+                  Pointer can be `NULL`. /n /n
+
+\return `RES_OK` if autocorrelation is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error".  /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API autocorr(double* x, int nx, int flag, int nr,
+                      fft_t* pfft, double* r, double* t)
+{
+  complex_t *buf = NULL;
+  double e;
+  int err, nfft, k, n;
+
+  if(!x || !r || !pfft)
+    return ERROR_PTR;
+  if(nx < 1 || nr < 0)
+    return ERROR_SIZE;
+  if(flag < DSPL_XCORR_NOSCALE || flag > DSPL_XCORR_NORMALIZED)
+    return ERROR_XCORR_FLAG;
+
+  nfft = xcorr_fft_size(nx, nx, nr);
+  buf = (complex_t*) malloc(nfft * sizeof(complex_t));
+  if(!buf)
+    return ERROR_MALLOC;
+
+  memset(buf, 0, nfft * sizeof(complex_t));
+  re2cmplx(x, nx, buf);
+
+  err = fft_cmplx(buf, nfft, pfft, buf);
+  if(err != RES_OK)
+    goto exit_label;
+
+  for(n = 0; n < nfft; n++)
+  {
+    RE(buf[n]) = ABSSQR(buf[n]);
+    IM(buf[n]) = 0.0;
+  }
+
+  err = ifft_cmplx(buf, nfft, pfft, buf);
+  if(err != RES_OK)
+    goto exit_label;
+
+  e = RE(buf[0]);
+  for(k = -nr; k <= nr; k++)
+  {
+    /* vector x is not overlapped for lags |k| > nx-1 */
+    if(k < 1 - nx || k > nx - 1)
+    {
+      r[k+nr] = 0.0;
+      continue;
+    }
+    n = k < 0 ? k + nfft : k;
+    r[k+nr] = RE(buf[n]) * xcorr_lag_scale(k, nx, nx, flag, e);
+  }
+
+  if(t)
+    for(k = -nr; k <= nr; k++)
+      t[k+nr] = (double)k;
+
+exit_label:
+  if(buf)
+    free(buf);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int xcorr(double* x, int nx, double* y, int ny, int flag, int nr,
+              fft_t* pfft, double* r, double* t)
+\brief Real vectors cross-correlation function by using FFT
+
+Function calculates cross-correlation of the real vectors `x` and `y`
+\f[
+  r(k) = \sum_{n} x(n+k) y(n), \qquad k = -n_r \ldots n_r
+\f]
+as inverse FFT of the cross-spectrum \f$ X(m) Y^*(m) \f$.
+Both real vectors are transformed by one complex FFT of the
+vector \f$ x(n) + j y(n) \f$ and spectra \f$ X(m) \f$ and \f$ Y(m) \f$
+are separated by using spectrum symmetry. FFT size is the minimal power of 2
+which provides lags `-nr ... nr` without circular aliasing,
+so the short lag window reduces FFT size.
+
+\param[in]  x     Pointer to the first input vector `x`. /n
+                  Vector size is `[nx x 1]`. /n /n
+
+\param[in]  nx    Size of the vector `x`. /n /n
+
+\param[in]  y     Pointer to the second input vector `y`. /n
+                  Vector size is `[ny x 1]`. /n /n
+
+\param[in]  ny    Size of the vector `y`. /n /n
+
+\param[in]  flag  Cross-correlation scaling: /n
+\verbatim
+DSPL_XCORR_NOSCALE     no scaling
+DSPL_XCORR_BIASED      r(k) / max(nx, ny)
+DSPL_XCORR_UNBIASED    r(k) / (number of overlapped samples for lag k)
+DSPL_XCORR_NORMALIZED  r(k) / sqrt(rxx(0) * ryy(0))
+\endverbatim
+
+\param[in]  nr    Maximal lag. /n
+                  Lags `-nr ... nr` are calculated. /n /n
+
+\param[in]  pfft  Pointer to the structure `fft_t`. /n
+                  Function changes `fft_t` structure fields so `fft_t` must
+                  be clear before program returns. /n /n
+
+\param[out] r     Pointer to the cross-correlation vector. /n
+                  Vector size is `[2*nr+1 x 1]`. /n
+                  `r[nr]` corresponds to zero lag. /n
+                  Memory must be allocated. /n /n
+
+\param[out] t     Pointer to the lag vector `-nr ... nr`. /n
+                  Vector size is `[2*nr+1 x 1]`. /n
+                  Pointer can be `NULL`. /n /n
+
+\return `RES_OK` if cross-correlation is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error".  /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API xcorr(double* x, int nx, double* y, int ny, int flag, int nr,
+                   fft_t* pfft, double* r, double* t)
+{
+  complex_t *buf = NULL;
+  double xr, xi, yr, yi, rr, ri, e, ex, ey;
+  int err, nfft, k, m, n;
+
+  if(!x || !y || !r || !pfft)
+    return ERROR_PTR;
+  if(nx < 1 || ny < 1 || nr < 0)
+    return ERROR_SIZE;
+  if(flag < DSPL_XCORR_NOSCALE || flag > DSPL_XCORR_NORMALIZED)
+    return ERROR_XCORR_FLAG;
+
+  nfft = xcorr_fft_size(nx, ny, nr);
+  buf = (complex_t*) malloc(nfft * sizeof(complex_t));
+  if(!buf)
+    return ERROR_MALLOC;
+
+  memset(buf, 0, nfft * sizeof(complex_t));
+  for(n = 0; n < nx; n++)
+    RE(buf[n]) = x[n];
+  for(n = 0; n < ny; n++)
+    IM(buf[n]) = y[n];
+
+  err = fft_cmplx(buf, nfft, pfft, buf);
+  if(err != RES_OK)
+    goto exit_label;
+
+  /* X(k) = (Z(k) + Z*(-k)) / 2,  Y(k) = (Z(k) - Z*(-k)) / 2j,
+     cross-spectrum X(k) Y*(k) is Hermitian for real x and y */
+  for(k = 0; k <= nfft/2; k++)
+  {
+    m = k ? nfft - k : 0;
+    xr = 0.5 * (RE(buf[k]) + RE(buf[m]));
+    xi = 0.5 * (IM(buf[k]) - IM(buf[m]));
+    yr = 0.5 * (IM(buf[k]) + IM(buf[m]));
+    yi = 0.5 * (RE(buf[m]) - RE(buf[k]));
+
+    rr = xr * yr + xi * yi;
+    ri = xi * yr - xr * yi;
+
+    RE(buf[k]) = RE(buf[m]) = rr;
+    IM(buf[k]) =  ri;
+    IM(buf[m]) = -ri;
+  }
+
+  err = ifft_cmplx(buf, nfft, pfft, buf);
+  if(err != RES_OK)
+    goto exit_label;
+
+  e = 0.0;
+  if(flag == DSPL_XCORR_NORMALIZED)
+  {
+    ex = ey = 0.0;
+    for(n = 0; n < nx; n++)
+      ex += x[n] * x[n];
+    for(n = 0; n < ny; n++)
+      ey += y[n] * y[n];
+    e = sqrt(ex * ey);
+  }
+
+  for(k = -nr; k <= nr; k++)
+  {
+    /* vectors x and y are not overlapped for lags k < 1-ny and k > nx-1 */
+    if(k < 1 - ny || k > nx - 1)
+    {
+      r[k+nr] = 0.0;
+      continue;
+    }
+    n = k < 0 ? k + nfft : k;
+    r[k+nr] = RE(buf[n]) * xcorr_lag_scale(k, nx, ny, flag, e);
+  }
+
+  if(t)
+    for(k = -nr; k <= nr; k++)
+      t[k+nr] = (double)k;
+
+exit_label:
+  if(buf)
+    free(buf);
+  return err;
+}
+
+
+
+
+/******************************************************************************
+\ingroup FILTER_CONV_GROUP
+\fn int xcorr_cmplx(complex_t* x, int nx, complex_t* y, int ny, int flag,
+                    int nr, fft_t* pfft, complex_t* r, double* t)
+\brief Complex vectors cross-correlation function by using FFT
+
+Function calculates cross-correlation of the complex vectors `x` and `y`
+\f[
+  r(k) = \sum_{n} x(n+k) y^*(n), \qquad k = -n_r \ldots n_r
+\f]
+as inverse FFT of the cross-spectrum \f$ X(m) Y^*(m) \f$.
+FFT size is the minimal power of 2 which provides lags `-nr ... nr`
+without circular aliasing.
+
+\param[in]  x     Pointer to the first input vector `x`. /n
+                  Vector size is `[nx x 1]`. /n /n
+
+\param[in]  nx    Size of the vector `x`. /n /n
+
+\param[in]  y     Pointer to the second input vector `y`. /n
+                  Vector size is `[ny x 1]`. /n /n
+
+\param[in]  ny    Size of the vector `y`. /n /n
+
+\param[in]  flag  Cross-correlation scaling
+                  (see \ref xcorr function description). /n /n
+
+\param[in]  nr    Maximal lag. /n
+                  Lags `-nr ... nr` are calculated. /n /n
+
+\param[in]  pfft  Pointer to the structure `fft_t`. /n
+                  Function changes `fft_t` structure fields so `fft_t` must
+                  be clear before program returns. /n /n
+
+\param[out] r     Pointer to the cross-correlation vector. /n
+                  Vector size is `[2*nr+1 x 1]`. /n
+                  `r[nr]` corresponds to zero lag. /n
+                  Memory must be allocated. /n /n
+
+\param[out] t     Pointer to the lag vector `-nr ... nr`. /n
+                  Vector size is `[2*nr+1 x 1]`. /n
+                  Pointer can be `NULL`. /n /n
+
+\return `RES_OK` if cross-correlation is calculated successfully. /n
+Else \ref ERROR_CODE_GROUP "code error".  /n /n
+
+\author Sergey Bakhurin www.dsplib.org
+*******************************************************************************/
+int DSPL_API xcorr_cmplx(complex_t* x, int nx, complex_t* y, int ny,
+                         int flag, int nr, fft_t* pfft,
+                         complex_t* r, double* t)
+{
+  complex_t *bx = NULL, *by = NULL;
+  double rr, ri, s, e, ex, ey;
+  int err, nfft, k, n;
+
+  if(!x || !y || !r || !pfft)
+    return ERROR_PTR;
+  if(nx < 1 || ny < 1 || nr < 0)
+    return ERROR_SIZE;
+  if(flag < DSPL_XCORR_NOSCALE || flag > DSPL_XCORR_NORMALIZED)
+    return ERROR_XCORR_FLAG;
+
+  nfft = xcorr_fft_size(nx, ny, nr);
+  bx = (complex_t*) malloc(nfft * sizeof(complex_t));
+  by = (complex_t*) malloc(nfft * sizeof(complex_t));
+  if(!bx || !by)
+  {
+    err = ERROR_MALLOC;
+    goto exit_label;
+  }
+
+  memset(bx, 0, nfft * sizeof(complex_t));
+  memset(by, 0, nfft * sizeof(complex_t));
+  memcpy(bx, x, nx * sizeof(complex_t));
+  memcpy(by, y, ny * sizeof(complex_t));
+
+  err = fft_cmplx(bx, nfft, pfft, bx);
+  if(err != RES_OK)
+    goto exit_label;
+  err = fft_cmplx(by, nfft, pfft, by);
+  if(err != RES_OK)
+    goto exit_label;
+
+  for(n = 0; n < nfft; n++)
+  {
+    rr = CMCONJRE(bx[n], by[n]);
+    ri = CMCONJIM(bx[n], by[n]);
+    RE(bx[n]) = rr;
+    IM(bx[n]) = ri;
+  }
+
+  err = ifft_cmplx(bx, nfft, pfft, bx);
+  if(err != RES_OK)
+    goto exit_label;
+
+  e = 0.0;
+  if(flag == DSPL_XCORR_NORMALIZED)
+  {
+    ex = ey = 0.0;
+    for(n = 0; n < nx; n++)
+      ex += ABSSQR(x[n]);
+    for(n = 0; n < ny; n++)
+      ey += ABSSQR(y[n]);
+    e = sqrt(ex * ey);
+  }
+
+  for(k = -nr; k <= nr; k++)
+  {
+    /* vectors x and y are not overlapped for lags k < 1-ny and k > nx-1 */
+    if(k < 1 - ny || k > nx - 1)
+    {
+      RE(r[k+nr]) = IM(r[k+nr]) = 0.0;
+      continue;
+    }
+    n = k < 0 ? k + nfft : k;
+    s = xcorr_lag_scale(k, nx, ny, flag, e);
+    RE(r[k+nr]) = RE(bx[n]) * s;
+    IM(r[k+nr]) = IM(bx[n]) * s;
+  }
+
+  if(t)
+    for(k = -nr; k <= nr; k++)
+      t[k+nr] = (double)k;
+
+exit_label:
+  if(bx)
+    free(bx);
+  if(by)
+    free(by);
+  return err;
+}
+
+
+
+
+/*******************************************************************************
+Minimal power of 2 FFT size for cross-correlation lags -nr ... nr
+without circular aliasing
+*******************************************************************************/
+int xcorr_fft_size(int nx, int ny, int nr)
+{
+  int nmin, n1, n2, nfft;
+
+  n1 = nx + (nr < ny - 1 ? nr : ny - 1);
+  n2 = ny + (nr < nx - 1 ? nr : nx - 1);
+  nmin = n1 > n2 ? n1 : n2;
+
+  nfft = 2;
+  while(nfft < nmin)
+    nfft *= 2;
+  return nfft;
+}
+
+
+
+
+/*******************************************************************************
+Cross-correlation scale factor for lag k.
+Returns zero if vectors x and y are not overlapped for lag k.
+*******************************************************************************/
+double xcorr_lag_scale(int k, int nx, int ny, int flag, double e)
+{
+  int cnt;
+
+  /* number of overlapped samples x(n+k) y(n) */
+  cnt = (ny < nx - k ? ny : nx - k) - (k < 0 ? -k : 0);
+  if(cnt < 1)
+    return 0.0;
+
+  switch(flag)
+  {
+    case DSPL_XCORR_BIASED:
+      return 1.0 / (double)(nx > ny ? nx : ny);
+    case DSPL_XCORR_UNBIASED:
+      return 1.0 / (double)cnt;
+    case DSPL_XCORR_NORMALIZED:
+      return e > 0.0 ? 1.0 / e : 1.0;
+    default:
+      return 1.0;
+  }
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "dspl.h"
+
+/* input signal length */
+#define N     100000
+
+/* number of repeats for each filter length */
+#define NREP  20
+
+
+/*******************************************************************************
+ * Reference convolution (direct scatter loop)
+ ******************************************************************************/
+void conv_ref(double* a, int na, double* b, int nb, double* c)
+{
+  int k, n;
+  memset(c, 0, (na+nb-1)*sizeof(double));
+  for(k = 0; k < na; k++)
+    for(n = 0; n < nb; n++)
+      c[k+n] += a[k]*b[n];
+}
+
+
+
+/*******************************************************************************
+ * Main program
+ ******************************************************************************/
+int main(int argc, char* argv[])
+{
+  void* hdspl;           /* DSPL handle         */
+  random_t rnd = {0};    /* random structure    */
+  double *x = NULL, *y = NULL, *z = NULL;
+  double h[64];
+  double err, t_ref, t_conv;
+  clock_t t0;
+  int nb, k;
+
+  hdspl = dspl_load();   /* Load DSPL functions */
+  if(!hdspl)
+    return 0;
+
+  x = (double*)malloc(N*sizeof(double));
+  y = (double*)malloc((N+64)*sizeof(double));
+  z = (double*)malloc((N+64)*sizeof(double));
+
+  random_init(&rnd, RAND_TYPE_MT19937, NULL);
+  randn(x, N, 0.0, 1.0, &rnd);
+  randn(h, 64, 0.0, 1.0, &rnd);
+
+  printf("  nb     ref (ms)    conv (ms)   speedup    error\n");
+  for(nb = 8; nb <= 64; nb *= 2)
+  {
+    t0 = clock();
+    for(k = 0; k < NREP; k++)
+      conv_ref(x, N, h, nb, y);
+    t_ref = (double)(clock() - t0) * 1E3 / CLOCKS_PER_SEC / NREP;
+
+    t0 = clock();
+    for(k = 0; k < NREP; k++)
+      conv(x, N, h, nb, z);
+    t_conv = (double)(clock() - t0) * 1E3 / CLOCKS_PER_SEC / NREP;
+
+    verif(y, z, N+nb-1, 1E-10, &err);
+    printf("%4d   %10.3f   %10.3f   %7.2f    %.3e\n",
+           nb, t_ref, t_conv, t_ref / t_conv, err);
+  }
+
+  free(x);
+  free(y);
+  free(z);
+
+  /* free dspl handle */
+  dspl_free(hdspl);
+  return 0;
+}
@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+/* bandpass filter specification */
+#define RP    1.0
+#define RS    60.0
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double wp[2] = {0.3, 0.5};
+  double ws[2] = {0.2, 0.6};
+  double *b = NULL, *a = NULL;
+  int ord, k, err;
+
+  int approx[6] = {DSPL_FILTER_BUTTER, DSPL_FILTER_CHEBY1,
+                   DSPL_FILTER_CHEBY2, DSPL_FILTER_ELLIP,
+                   DSPL_FILTER_FIR_KAISER, DSPL_FILTER_FIR_REMEZ};
+  char* name[6] = {"Butterworth", "Chebyshev 1", "Chebyshev 2",
+                   "Elliptic", "FIR Kaiser", "FIR Remez"};
+
+  // minimal order bandpass filters for the same specification
+  for(k = 0; k < 6; k++)
+  {
+    err = filter_design(RP, RS, wp, ws, DSPL_FILTER_BPASS | approx[k],
+                        &ord, &b, &a);
+    printf("%-12s  error: 0x%.8x  ord = %d\n", name[k], err, ord);
+  }
+
+  if(b)
+    free(b);
+  if(a)
+    free(a);
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
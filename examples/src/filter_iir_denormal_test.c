@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "dspl.h"
+
+#define ORD   6
+#define BLK   65536
+#define NBLK  64
+
+/* Filter the unit impulse followed by silence block by block and return
+   the ratio of the slowest block time to the first block time */
+double decay_test(filter_iir_t* pf, double* x, double* y)
+{
+  clock_t t;
+  double tb, t0 = 0.0, tmax = 0.0;
+  int k;
+
+  filter_iir_init(pf, 0.0);
+  for(k = 0; k < NBLK; k++)
+  {
+    memset(x, 0, BLK*sizeof(double));
+    if(!k)
+      x[0] = 1.0;
+    t = clock();
+    filter_iir_process(pf, x, BLK, y);
+    tb = (double)(clock() - t) / CLOCKS_PER_SEC;
+    if(!k)
+      t0 = tb;
+    else if(tb > tmax)
+      tmax = tb;
+  }
+  return tmax / (t0 > 0.0 ? t0 : 1.0 / CLOCKS_PER_SEC);
+}
+
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double b[ORD+1], a[ORD+1];
+  double *x, *y;
+  double r_off, r_on;
+  filter_iir_t flt;
+  int err;
+
+  x = (double*) malloc(BLK*sizeof(double));
+  y = (double*) malloc(BLK*sizeof(double));
+  memset(&flt, 0, sizeof(filter_iir_t));
+
+  // narrow band LPF, impulse response decays slowly into denormals
+  err = iir(1.0, 60.0, ORD, 0.01, 0.0,
+            DSPL_FILTER_LPF | DSPL_FILTER_BUTTER, b, a);
+  if(err == RES_OK)
+    err = filter_iir_create(&flt, b, a, ORD);
+  printf("filter error: 0x%.8x\n", err);
+
+  dspl_ftz_mode(DSPL_FTZ_OFF);
+  r_off = decay_test(&flt, x, y);
+
+  dspl_ftz_mode(DSPL_FTZ_ON);
+  r_on = decay_test(&flt, x, y);
+
+  printf("silence / first block time, FTZ off: %8.2f\n", r_off);
+  printf("silence / first block time, FTZ on:  %8.2f\n", r_on);
+  printf("throughput on decaying silence: %s\n",
+         r_on < 2.0 ? "FLAT" : "DEGRADED");
+
+  filter_iir_free(&flt);
+  free(x);
+  free(y);
+  dspl_free(handle);      // free dspl handle
+  return r_on < 2.0 ? 0 : 1;
+}
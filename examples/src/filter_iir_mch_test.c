@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define ORD 6
+#define N   1000
+#define NCH 21
+
+/* Multichannel filtration is compared with filter_iir function
+   called for each channel, for interleaved and planar layouts. */
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double b[ORD+1], a[ORD+1], z[ORD*NCH];
+  double *x, *y, *xc, *yc;
+  double e;
+  random_t rnd;
+  int c, k, err;
+
+  x  = (double*) malloc((2*N*NCH + 2*N) * sizeof(double));
+  y  = x  + N*NCH;
+  xc = y  + N*NCH;
+  yc = xc + N;
+
+  random_init(&rnd, RAND_TYPE_MRG32K3A, NULL);
+  randn(x, N*NCH, 0.0, 1.0, &rnd);
+
+  err = iir(1.0, 60.0, ORD, 0.2, 0.0, DSPL_FILTER_LPF | DSPL_FILTER_ELLIP,
+            b, a);
+  printf("iir error: 0x%.8x\n", err);
+
+  /* interleaved: sample k of channel c is x[k*NCH + c].
+     Signal is filtered by two calls, delay line keeps the state */
+  memset(z, 0, sizeof(z));
+  err = filter_iir_mch(b, a, ORD, z, x, N/2, NCH, DSPL_MCH_INTERLEAVED, y);
+  err = filter_iir_mch(b, a, ORD, z, x + N/2*NCH, N - N/2, NCH,
+                       DSPL_MCH_INTERLEAVED, y + N/2*NCH);
+  printf("filter_iir_mch (interleaved) error: 0x%.8x\n", err);
+  e = 0.0;
+  for(c = 0; c < NCH; c++)
+  {
+    for(k = 0; k < N; k++)
+      xc[k] = x[k*NCH + c];
+    filter_iir(b, a, ORD, xc, N, yc);
+    for(k = 0; k < N; k++)
+      e = fabs(y[k*NCH + c] - yc[k]) > e ? fabs(y[k*NCH + c] - yc[k]) : e;
+  }
+  printf("interleaved max error: %.1e\n", e);
+
+  /* planar: sample k of channel c is x[c*N + k], filtered in place */
+  memcpy(y, x, N*NCH*sizeof(double));
+  err = filter_iir_mch(b, a, ORD, NULL, y, N, NCH, DSPL_MCH_PLANAR, y);
+  printf("filter_iir_mch (planar) error: 0x%.8x\n", err);
+  e = 0.0;
+  for(c = 0; c < NCH; c++)
+  {
+    filter_iir(b, a, ORD, x + c*N, N, yc);
+    for(k = 0; k < N; k++)
+      e = fabs(y[c*N + k] - yc[k]) > e ? fabs(y[c*N + k] - yc[k]) : e;
+  }
+  printf("planar max error: %.1e\n", e);
+
+  free(x);
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
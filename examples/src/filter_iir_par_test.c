@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define N       200000
+#define ORD_MAX 10
+
+/* Block-parallel IIR filtration is compared with the serial filtration
+   for high order narrowband filters (poles are clustered near z = 1).
+   Run with OMP_NUM_THREADS > 1 to use the parallel path.
+   Error is relative to the output peak, it is at the level of the serial
+   transposed direct form II rounding error for the same poles. */
+
+static int par_test(char* name, int ord, double w, int type,
+                    double* x, double* y0, double* y1)
+{
+  double b[ORD_MAX+1], a[ORD_MAX+1];
+  double z0[ORD_MAX], z1[ORD_MAX];
+  double e, m;
+  int k, err;
+
+  err = iir(1.0, 60.0, ord, w, 0.0, type, b, a);
+  if(err != RES_OK)
+  {
+    printf("%-16s iir error: 0x%.8x\n", name, err);
+    return err;
+  }
+
+  /* two calls, so the delay line is checked too */
+  memset(z0, 0, sizeof(z0));
+  memset(z1, 0, sizeof(z1));
+  filter_iir_par(b, a, ord, z0, x, N/2, y0);
+  filter_iir_par(b, a, ord, z0, x+N/2, N/2, y0+N/2);
+  filter_iir(b, a, ord, x, N, y1);
+
+  e = m = 0.0;
+  for(k = 0; k < N; k++)
+  {
+    if(fabs(y0[k] - y1[k]) > e || y0[k] != y0[k])
+      e = fabs(y0[k] - y1[k]);
+    if(fabs(y1[k]) > m)
+      m = fabs(y1[k]);
+  }
+  printf("%-16s ord = %2d  w = %.2f  max error: %.1e\n",
+         name, ord, w, e / m);
+  return RES_OK;
+}
+
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double *x, *y0, *y1;
+  random_t rnd;
+
+  x  = (double*) malloc(3 * N * sizeof(double));
+  y0 = x  + N;
+  y1 = y0 + N;
+
+  random_init(&rnd, RAND_TYPE_MRG32K3A, NULL);
+  randn(x, N, 0.0, 1.0, &rnd);
+
+  par_test("butter",  4, 0.05, DSPL_FILTER_LPF | DSPL_FILTER_BUTTER,
+           x, y0, y1);
+  par_test("butter",  8, 0.05, DSPL_FILTER_LPF | DSPL_FILTER_BUTTER,
+           x, y0, y1);
+  par_test("butter", 10, 0.02, DSPL_FILTER_LPF | DSPL_FILTER_BUTTER,
+           x, y0, y1);
+  par_test("ellip",   6, 0.05, DSPL_FILTER_LPF | DSPL_FILTER_ELLIP,
+           x, y0, y1);
+  par_test("ellip",   8, 0.05, DSPL_FILTER_LPF | DSPL_FILTER_ELLIP,
+           x, y0, y1);
+  par_test("ellip",  10, 0.05, DSPL_FILTER_LPF | DSPL_FILTER_ELLIP,
+           x, y0, y1);
+  par_test("ellip",  10, 0.20, DSPL_FILTER_LPF | DSPL_FILTER_ELLIP,
+           x, y0, y1);
+
+  free(x);
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
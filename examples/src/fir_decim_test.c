@@ -0,0 +1,50 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+#define N     4096
+#define D     8
+#define ORD   95
+#define BLOCK 1000
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double x[N], y[N/D+1], h[ORD+1];
+  fir_decim_t pd;
+  int n, k, ny, cnt, err;
+
+  memset(&pd, 0, sizeof(fir_decim_t));
+
+  // antialiasing LPF, cutoff frequency is 1/D of the Nyquist frequency
+  err = fir_linphase(ORD, 1.0/D, 0.0, DSPL_FILTER_LPF,
+                     DSPL_WIN_BLACKMAN, 0.0, h);
+  printf("fir_linphase error: 0x%.8x\n", err);
+
+  // tone 0.02 of the sampling frequency plus tone 0.3 which is rejected
+  for(n = 0; n < N; n++)
+    x[n] = sin(M_2PI * 0.02 * n) + sin(M_2PI * 0.3 * n);
+
+  err = fir_decim_create(&pd, h, ORD+1, D);
+  printf("fir_decim_create error: 0x%.8x\n", err);
+
+  // stream processing by blocks
+  cnt = 0;
+  for(n = 0; n < N; n += BLOCK)
+  {
+    k = N - n < BLOCK ? N - n : BLOCK;
+    err = fir_decim_process(&pd, x + n, k, y + cnt, &ny);
+    cnt += ny;
+  }
+  printf("fir_decim_process error: 0x%.8x, output size: %d\n", err, cnt);
+
+  for(n = 100; n < 110; n++)
+    printf("y[%3d] = %8.4f    ref = %8.4f\n", n, y[n],
+           sin(M_2PI * 0.02 * (n*D - ORD/2.0)));
+
+  fir_decim_free(&pd);    // free decimator memory
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+#define N     1000
+#define L     4
+#define ORD   63
+#define BLOCK 300
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double x[N], xs[N*L], y[N*L], r[N*L+ORD], h[ORD+1];
+  complex_t xc[N], yc[N*L];
+  fir_interp_t pi;
+  int n, k, err;
+  double e, ec;
+
+  memset(&pi, 0, sizeof(fir_interp_t));
+
+  // interpolation LPF, cutoff frequency is 1/L of the Nyquist frequency,
+  // gain L compensates zeros insertion
+  err = fir_linphase(ORD, 1.0/L, 0.0, DSPL_FILTER_LPF,
+                     DSPL_WIN_BLACKMAN, 0.0, h);
+  printf("fir_linphase error: 0x%.8x\n", err);
+  for(n = 0; n < ORD+1; n++)
+    h[n] *= L;
+
+  for(n = 0; n < N; n++)
+  {
+    x[n] = sin(M_2PI * 0.03 * n);
+    RE(xc[n]) = x[n];
+    IM(xc[n]) = cos(M_2PI * 0.03 * n);
+  }
+
+  err = fir_interp_create(&pi, h, ORD+1, L);
+  printf("fir_interp_create error: 0x%.8x\n", err);
+
+  // stream processing by blocks
+  for(n = 0; n < N; n += BLOCK)
+  {
+    k = N - n < BLOCK ? N - n : BLOCK;
+    err = fir_interp_process(&pi, x + n, k, y + n*L);
+  }
+  printf("fir_interp_process error: 0x%.8x\n", err);
+
+  // complex input, delay line is cleared by the new interpolator
+  fir_interp_free(&pi);
+  memset(&pi, 0, sizeof(fir_interp_t));
+  fir_interp_create(&pi, h, ORD+1, L);
+  for(n = 0; n < N; n += BLOCK)
+  {
+    k = N - n < BLOCK ? N - n : BLOCK;
+    err = fir_interp_process_cmplx(&pi, xc + n, k, yc + n*L);
+  }
+  printf("fir_interp_process_cmplx error: 0x%.8x\n", err);
+
+  // reference: zeros insertion and filtration at the high sampling rate
+  memset(xs, 0, sizeof(xs));
+  for(n = 0; n < N; n++)
+    xs[n*L] = x[n];
+  conv(xs, N*L, h, ORD+1, r);
+
+  e = ec = 0.0;
+  for(n = 0; n < N*L; n++)
+  {
+    e  = fabs(y[n] - r[n]) > e ? fabs(y[n] - r[n]) : e;
+    ec = fabs(RE(yc[n]) - r[n]) > ec ? fabs(RE(yc[n]) - r[n]) : ec;
+  }
+  printf("max error against zeros insertion and conv: %.1e\n", e);
+  printf("complex input real part max error:          %.1e\n", ec);
+
+  for(n = 400; n < 408; n++)
+    printf("y[%3d] = %8.4f    ref = %8.4f\n", n, y[n],
+           sin(M_2PI * 0.03 / L * (n - ORD/2.0)));
+
+  fir_interp_free(&pi);   // free interpolator memory
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
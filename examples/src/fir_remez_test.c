@@ -0,0 +1,67 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+#define RP    0.5
+#define RS    60.0
+#define WP    0.2
+#define WS    0.3
+#define ORD_MAX 128
+
+/* Frequency response vector size */
+#define N  1024
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double h[ORD_MAX+1], w[N], mag[N], wt[2];
+  double bands[4] = {0.0, WP, WS, 1.0};
+  double des[4]   = {1.0, 1.0, 0.0, 0.0};
+  double pmax, pmin, smax;
+  int ord, k, err;
+
+  // order and bands weights estimation
+  err = fir_remez_ord(RP, RS, WP, WS, &ord, wt);
+  printf("fir_remez_ord error: 0x%.8x, ord = %d\n", err, ord);
+
+  // increase order until the specification is satisfied
+  for(; ord < ORD_MAX; ord++)
+  {
+    err = fir_remez(ord, bands, des, wt, 2, DSPL_FIR_SYMMETRIC, h);
+    if(err != RES_OK)
+    {
+      printf("fir_remez error: 0x%.8x\n", err);
+      break;
+    }
+
+    linspace(0, M_PI, N, DSPL_SYMMETRIC, w);
+    filter_freq_resp(h, NULL, ord, w, N, DSPL_FLAG_LOGMAG, mag, NULL, NULL);
+    pmax = -1000.0;
+    pmin =  1000.0;
+    smax = -1000.0;
+    for(k = 0; k < N; k++)
+    {
+      if(w[k] <= WP * M_PI)
+      {
+        pmax = mag[k] > pmax ? mag[k] : pmax;
+        pmin = mag[k] < pmin ? mag[k] : pmin;
+      }
+      if(w[k] >= WS * M_PI)
+        smax = mag[k] > smax ? mag[k] : smax;
+    }
+    printf("ord = %3d  passband ripple = %.3f dB  stopband = %.2f dB\n",
+           ord, pmax - pmin, smax);
+    if(pmax - pmin <= RP && smax <= -RS)
+      break;
+  }
+
+  for(k = 0; k < N; k++)
+    w[k] /= M_PI;
+  writetxt(w, mag, N, "dat/fir_remez_lpf.txt");
+
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define FIR_ORD 64
+#define IIR_ORD 6
+#define N       1000
+
+/* Frequency response on the uniform sub-band grid by the chirp
+   z-transform is compared with freqz function at the same frequencies.
+   Error is relative to max |H(w)| on the grid. */
+
+static double czt_err(double* b, double* a, int ord, double w0, double dw,
+                      fft_t* pfft)
+{
+  complex_t h0[N], h1[N];
+  double w[N], d, e, m;
+  int k, err;
+
+  for(k = 0; k < N; k++)
+    w[k] = w0 + (double)k * dw;
+  freqz(b, a, ord, w, N, h0);
+  err = freqz_czt(b, a, ord, w0, dw, N, pfft, h1);
+  if(err != RES_OK)
+  {
+    printf("freqz_czt error: 0x%.8x\n", err);
+    return -1.0;
+  }
+
+  e = m = 0.0;
+  for(k = 0; k < N; k++)
+  {
+    d = sqrt((RE(h0[k]) - RE(h1[k])) * (RE(h0[k]) - RE(h1[k])) +
+             (IM(h0[k]) - IM(h1[k])) * (IM(h0[k]) - IM(h1[k])));
+    e = d > e ? d : e;
+    m = ABS(h0[k]) > m ? ABS(h0[k]) : m;
+  }
+  return e / m;
+}
+
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double h[FIR_ORD+1], b[IIR_ORD+1], a[IIR_ORD+1];
+  fft_t pfft;
+  int err;
+
+  memset(&pfft, 0, sizeof(fft_t));
+
+  /* FIR filter passband [0, 0.3*pi] and transition band */
+  err = fir_linphase(FIR_ORD, 0.3, 0.0, DSPL_FILTER_LPF,
+                     DSPL_WIN_BLACKMAN, 0.0, h);
+  printf("fir_linphase error: 0x%.8x\n", err);
+  printf("FIR passband   max error: %.1e\n",
+         czt_err(h, NULL, FIR_ORD, 0.0, 0.3 * M_PI / N, &pfft));
+  printf("FIR transition max error: %.1e\n",
+         czt_err(h, NULL, FIR_ORD, 0.25 * M_PI, 0.2 * M_PI / N, &pfft));
+
+  /* low order IIR filter passband ripple. Error is larger than for FIR
+     filter, because it is relative to max |B(w)| and |A(w)| */
+  err = iir(1.0, 60.0, IIR_ORD, 0.2, 0.0,
+            DSPL_FILTER_LPF | DSPL_FILTER_ELLIP, b, a);
+  printf("iir error: 0x%.8x\n", err);
+  printf("IIR passband   max error: %.1e\n",
+         czt_err(b, a, IIR_ORD, 0.0, 0.2 * M_PI / N, &pfft));
+
+  fft_free(&pfft);        // free fft structure memory
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define N     4096
+#define D     8
+#define WP    0.8
+#define RS    80.0
+#define BLOCK 1000
+
+/* Multistage half-band decimator and interpolator are compared with
+   the reference cascade of fir_halfband filters calculated by filter_iir
+   function with downsampling (zero stuffing for interpolator). */
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  int ord[DSPL_HALFBAND_STAGES_MAX];
+  double *x, *y, *r, *t, *h;
+  double beta, e, m;
+  halfband_t hb;
+  random_t rnd;
+  int nst, ny, cnt, k, s, n, tmp, err;
+
+  x = (double*) malloc((N + 3*N*D + 1) * sizeof(double));
+  y = x + N;
+  r = y + N*D;
+  t = r + N*D;
+
+  random_init(&rnd, RAND_TYPE_MRG32K3A, NULL);
+  randn(x, N, 0.0, 1.0, &rnd);
+
+  err = halfband_plan(D, WP, RS, ord, &nst);
+  printf("halfband_plan error: 0x%.8x, stages: %d, orders:", err, nst);
+  for(s = 0; s < nst; s++)
+    printf(" %d", ord[s]);
+  printf("\n");
+
+  memset(&hb, 0, sizeof(halfband_t));
+  err = halfband_create(&hb, D, WP, RS);
+  printf("halfband_create error: 0x%.8x\n", err);
+
+  // Kaiser window parameter for RS (stopband deviation is less
+  // than passband deviation for 1 dB ripple)
+  fir_kaiser_ord(1.0, RS, 0.2, 0.3, &tmp, &beta);
+  h = (double*) malloc((ord[nst-1] + 1) * sizeof(double));
+
+  /* decimation by blocks */
+  cnt = 0;
+  for(k = 0; k < N; k += BLOCK)
+  {
+    err = halfband_decim_process(&hb, x + k, N - k < BLOCK ? N - k : BLOCK,
+                                 y + cnt, &ny);
+    cnt += ny;
+  }
+  printf("halfband_decim_process error: 0x%.8x, output size: %d\n", err, cnt);
+
+  /* reference: filtration and downsampling of each stage */
+  memcpy(r, x, N * sizeof(double));
+  n = N;
+  for(s = 0; s < nst; s++)
+  {
+    fir_halfband(ord[s], DSPL_WIN_KAISER, beta, h);
+    filter_iir(h, NULL, ord[s], r, n, t);
+    n = (n + 1) / 2;
+    for(k = 0; k < n; k++)
+      r[k] = t[2*k];
+  }
+  e = m = 0.0;
+  for(k = 0; k < n && k < cnt; k++)
+  {
+    e = fabs(y[k] - r[k]) > e ? fabs(y[k] - r[k]) : e;
+    m = fabs(r[k]) > m ? fabs(r[k]) : m;
+  }
+  printf("decimator max error: %.1e (reference size: %d)\n", e / m, n);
+
+  /* interpolation of the decimator output by blocks.
+     Object is created again, so the delay lines are cleared */
+  err = halfband_create(&hb, D, WP, RS);
+  for(k = 0; k < cnt; k += BLOCK/D)
+    err = halfband_interp_process(&hb, y + k,
+                                  cnt - k < BLOCK/D ? cnt - k : BLOCK/D,
+                                  x + k*D);
+  printf("halfband_interp_process error: 0x%.8x, output size: %d\n",
+         err, cnt*D);
+
+  /* reference: zero stuffing and filtration of each stage,
+     filter gain is 2 to keep the signal level */
+  memcpy(r, y, cnt * sizeof(double));
+  n = cnt;
+  for(s = nst-1; s >= 0; s--)
+  {
+    fir_halfband(ord[s], DSPL_WIN_KAISER, beta, h);
+    for(k = 0; k < ord[s] + 1; k++)
+      h[k] *= 2.0;
+    for(k = 0; k < n; k++)
+    {
+      t[2*k]   = r[k];
+      t[2*k+1] = 0.0;
+    }
+    n *= 2;
+    filter_iir(h, NULL, ord[s], t, n, r);
+  }
+  e = m = 0.0;
+  for(k = 0; k < n; k++)
+  {
+    e = fabs(x[k] - r[k]) > e ? fabs(x[k] - r[k]) : e;
+    m = fabs(r[k]) > m ? fabs(r[k]) : m;
+  }
+  printf("interpolator max error: %.1e (reference size: %d)\n", e / m, n);
+
+  halfband_free(&hb);
+  free(h);
+  free(x);
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
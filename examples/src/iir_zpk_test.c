@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define ORD_MAX 10
+#define NW      512
+
+/* Zeros, poles and gain (iir_zpk) and second order sections (iir_sos,
+   filter_zpk2sos) are compared with the transfer function calculated by
+   iir function: frequency responses are compared on NW frequencies
+   (error is relative to max |H(w)|), filter_sos output is compared with
+   filter_iir output (relative to max |y|). */
+
+static void zpk_test(char* name, int ord, double w0, double w1, int type)
+{
+  complex_t z[ORD_MAX], p[ORD_MAX], hi[NW], hk[NW];
+  double b[ORD_MAX+1], a[ORD_MAX+1], sos[6*ORD_MAX];
+  double w[NW], x[NW], y0[NW], y1[NW], hr[NW], hm[NW];
+  double k, c, s, nr, ni, dr, di, tr, ti, d, ez, es, et, m;
+  random_t rnd;
+  int i, n, nsec, err;
+
+  err = iir(1.0, 60.0, ord, w0, w1, type, b, a);
+  if(err == RES_OK)
+    err = iir_zpk(1.0, 60.0, ord, w0, w1, type, z, p, &k);
+  if(err == RES_OK)
+    err = iir_sos(1.0, 60.0, ord, w0, w1, type, sos);
+  if(err != RES_OK)
+  {
+    printf("%-20s error: 0x%.8x\n", name, err);
+    return;
+  }
+  nsec = (ord + 1) / 2;
+
+  /* filter_iir normalizes the denominator only, so the coefficients
+     are normalized to a[0] = 1 */
+  d = a[0];
+  for(n = 0; n < ord + 1; n++)
+  {
+    b[n] /= d;
+    a[n] /= d;
+  }
+
+  linspace(0, M_PI, NW, DSPL_PERIODIC, w);
+  freqz(b, a, ord, w, NW, hi);
+
+  /* H(w) = k prod(1 - z_i exp(-jw)) / prod(1 - p_i exp(-jw)) */
+  m = ez = 0.0;
+  for(n = 0; n < NW; n++)
+  {
+    c = cos(w[n]);
+    s = -sin(w[n]);
+    nr = k;   ni = 0.0;
+    dr = 1.0; di = 0.0;
+    for(i = 0; i < ord; i++)
+    {
+      tr = 1.0 - (RE(z[i])*c - IM(z[i])*s);
+      ti =     - (RE(z[i])*s + IM(z[i])*c);
+      d  = nr*tr - ni*ti;
+      ni = nr*ti + ni*tr;
+      nr = d;
+      tr = 1.0 - (RE(p[i])*c - IM(p[i])*s);
+      ti =     - (RE(p[i])*s + IM(p[i])*c);
+      d  = dr*tr - di*ti;
+      di = dr*ti + di*tr;
+      dr = d;
+    }
+    d  = dr*dr + di*di;
+    tr = (nr*dr + ni*di) / d - RE(hi[n]);
+    ti = (ni*dr - nr*di) / d - IM(hi[n]);
+    ez = sqrt(tr*tr + ti*ti) > ez ? sqrt(tr*tr + ti*ti) : ez;
+    m  = ABS(hi[n]) > m ? ABS(hi[n]) : m;
+  }
+
+  /* second order sections frequency response is the sections product */
+  for(n = 0; n < NW; n++)
+  {
+    hr[n] = 1.0;
+    hm[n] = 0.0;
+  }
+  for(i = 0; i < nsec; i++)
+  {
+    freqz(sos + 6*i, sos + 6*i + 3, 2, w, NW, hk);
+    for(n = 0; n < NW; n++)
+    {
+      d     = hr[n]*RE(hk[n]) - hm[n]*IM(hk[n]);
+      hm[n] = hr[n]*IM(hk[n]) + hm[n]*RE(hk[n]);
+      hr[n] = d;
+    }
+  }
+  es = 0.0;
+  for(n = 0; n < NW; n++)
+  {
+    tr = hr[n] - RE(hi[n]);
+    ti = hm[n] - IM(hi[n]);
+    es = sqrt(tr*tr + ti*ti) > es ? sqrt(tr*tr + ti*ti) : es;
+  }
+
+  /* time domain: filter_zpk2sos and filter_sos against filter_iir */
+  random_init(&rnd, RAND_TYPE_MRG32K3A, NULL);
+  randn(x, NW, 0.0, 1.0, &rnd);
+  filter_zpk2sos(z, p, ord, k, sos);
+  filter_sos(sos, nsec, NULL, x, NW, y0);
+  filter_iir(b, a, ord, x, NW, y1);
+  et = d = 0.0;
+  for(n = 0; n < NW; n++)
+  {
+    et = fabs(y0[n] - y1[n]) > et ? fabs(y0[n] - y1[n]) : et;
+    d  = fabs(y1[n]) > d ? fabs(y1[n]) : d;
+  }
+
+  printf("%-20s zpk: %.1e   sos: %.1e   filter_sos: %.1e\n",
+         name, ez / m, es / m, et / d);
+}
+
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+
+  zpk_test("ellip LPF ord 7", 7, 0.3, 0.0,
+           DSPL_FILTER_LPF | DSPL_FILTER_ELLIP);
+  zpk_test("cheby1 HPF ord 6", 6, 0.4, 0.0,
+           DSPL_FILTER_HPF | DSPL_FILTER_CHEBY1);
+  zpk_test("cheby2 BPASS ord 8", 8, 0.2, 0.5,
+           DSPL_FILTER_BPASS | DSPL_FILTER_CHEBY2);
+  zpk_test("butter BSTOP ord 10", 10, 0.3, 0.6,
+           DSPL_FILTER_BSTOP | DSPL_FILTER_BUTTER);
+
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspl.h"
+
+#define NZ    100
+#define ORD   40
+#define IIR_ORD 80
+
+/* max |x - y| / |y| for nonzero y */
+double rel_err(double* x, double* y, int n)
+{
+  double e = 0.0, t;
+  int k;
+  for(k = 0; k < n; k++)
+  {
+    t = fabs(x[k] - y[k]) / fabs(y[k]);
+    if(t > e)
+      e = t;
+  }
+  return e;
+}
+
+/* max |x - y| / max |y| */
+double norm_err(double* x, double* y, int n)
+{
+  double e = 0.0, m = 0.0;
+  int k;
+  for(k = 0; k < n; k++)
+  {
+    if(fabs(x[k] - y[k]) > e)
+      e = fabs(x[k] - y[k]);
+    if(fabs(y[k]) > m)
+      m = fabs(y[k]);
+  }
+  return e / m;
+}
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  complex_t z[NZ], a0[NZ+1], a1[NZ+1];
+  double c[NZ+1], r0[NZ+1], r1[NZ+1];
+  double b[ORD+1], a[ORD+1], beta0[2*ORD+1], alpha0[2*ORD+1];
+  double beta1[2*ORD+1], alpha1[2*ORD+1];
+  double bi[IIR_ORD+1], ai[IIR_ORD+1];
+  double f[3] = {1.0, 0.0, 1.0};
+  double g[3] = {0.0, 1.0, 0.0};
+  int k, m, err;
+
+  // binomial coefficients C(NZ, k) are zeros at -1 polynomial coefficients
+  c[0] = 1.0;
+  for(k = 1; k < NZ+1; k++)
+    c[k] = c[k-1] * (double)(NZ - k + 1) / (double)k;
+
+  memset(z, 0, sizeof(z));
+  for(k = 0; k < NZ; k++)
+    RE(z[k]) = -1.0;
+
+  err = poly_z2a_cmplx(z, NZ, NZ, a0);
+  printf("poly_z2a_cmplx error: 0x%.8x\n", err);
+  err = poly_z2a_cmplx_fft(z, NZ, NZ, a1);
+  printf("poly_z2a_cmplx_fft error: 0x%.8x\n", err);
+  cmplx2re(a0, NZ+1, r0, NULL);
+  cmplx2re(a1, NZ+1, r1, NULL);
+  printf("%d zeros at -1, max relative coefficient error:\n", NZ);
+  printf("  direct %.1e    FFT %.1e\n", rel_err(r0, c, NZ+1),
+                                        rel_err(r1, c, NZ+1));
+
+  // lowpass to bandpass composition of the Butterworth prototype
+  err = butter_ap(1.0, ORD, b, a);
+  printf("butter_ap error: 0x%.8x\n", err);
+  err = ratcompos(b, a, ORD, f, g, 2, beta0, alpha0);
+  printf("ratcompos error: 0x%.8x\n", err);
+  err = ratcompos_fft(b, a, ORD, f, g, 2, beta1, alpha1);
+  printf("ratcompos_fft error: 0x%.8x\n", err);
+  printf("ratcompos order %d, FFT vs direct error (relative to max):\n", ORD);
+  printf("  numerator %.1e    denominator %.1e\n",
+         norm_err(beta1, beta0, 2*ORD+1), norm_err(alpha1, alpha0, 2*ORD+1));
+
+  // Butterworth digital LPF numerator is proportional to C(IIR_ORD, k)
+  err = iir(1.0, 60.0, IIR_ORD, 0.3, 0.0, DSPL_FILTER_LPF | DSPL_FILTER_BUTTER,
+            bi, ai);
+  printf("iir error: 0x%.8x\n", err);
+  c[0] = bi[0];
+  for(m = 1; m < IIR_ORD+1; m++)
+    c[m] = c[m-1] * (double)(IIR_ORD - m + 1) / (double)m;
+  printf("Butterworth order %d numerator max relative error: %.1e\n",
+         IIR_ORD, rel_err(bi, c, IIR_ORD+1));
+
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define ORD 12
+#define NP  200
+
+/* Roots of NP random polynomials are calculated by polyroots_batch
+   (cold and warm start) and compared with polyroots function roots.
+   Each polyroots root is matched with the nearest polyroots_batch root,
+   error is relative to max(1, |root|). */
+
+static double roots_err(complex_t* r0, complex_t* r1, int ord)
+{
+  int used[ORD];
+  double d, dmin, e, m;
+  int i, j, jmin;
+
+  memset(used, 0, sizeof(used));
+  e = 0.0;
+  for(i = 0; i < ord; i++)
+  {
+    jmin = 0;
+    dmin = -1.0;
+    for(j = 0; j < ord; j++)
+    {
+      d = sqrt((RE(r0[i]) - RE(r1[j])) * (RE(r0[i]) - RE(r1[j])) +
+               (IM(r0[i]) - IM(r1[j])) * (IM(r0[i]) - IM(r1[j])));
+      if(!used[j] && (dmin < 0.0 || d < dmin))
+      {
+        dmin = d;
+        jmin = j;
+      }
+    }
+    used[jmin] = 1;
+    m = ABS(r0[i]) > 1.0 ? ABS(r0[i]) : 1.0;
+    e = dmin / m > e ? dmin / m : e;
+  }
+  return e;
+}
+
+
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double *a, *p;
+  complex_t *r, r0[ORD];
+  double e, ek;
+  random_t rnd;
+  int k, nfb, info, err;
+
+  a = (double*) malloc(2 * NP * (ORD + 1) * sizeof(double));
+  p = a + NP * (ORD + 1);
+  r = (complex_t*) malloc(NP * ORD * sizeof(complex_t));
+
+  random_init(&rnd, RAND_TYPE_MRG32K3A, NULL);
+  randn(a, NP * (ORD + 1), 0.0, 1.0, &rnd);
+
+  /* cold start */
+  err = polyroots_batch(a, ORD, NP, DSPL_ROOTS_COLD, r, &nfb);
+  printf("polyroots_batch (cold) error: 0x%.8x, fallback: %d\n", err, nfb);
+  e = 0.0;
+  for(k = 0; k < NP; k++)
+  {
+    polyroots(a + k*(ORD+1), ORD, r0, &info);
+    ek = roots_err(r0, r + k*ORD, ORD);
+    e = ek > e ? ek : e;
+  }
+  printf("cold start max roots error: %.1e\n", e);
+
+  /* warm start: slightly changed polynomials, previous roots are
+     the initial approximations */
+  randn(p, NP * (ORD + 1), 0.0, 1E-3, &rnd);
+  for(k = 0; k < NP * (ORD + 1); k++)
+    p[k] += a[k];
+  err = polyroots_batch(p, ORD, NP, DSPL_ROOTS_WARM, r, &nfb);
+  printf("polyroots_batch (warm) error: 0x%.8x, fallback: %d\n", err, nfb);
+  e = 0.0;
+  for(k = 0; k < NP; k++)
+  {
+    polyroots(p + k*(ORD+1), ORD, r0, &info);
+    ek = roots_err(r0, r + k*ORD, ORD);
+    e = ek > e ? ek : e;
+  }
+  printf("warm start max roots error: %.1e\n", e);
+
+  free(r);
+  free(a);
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
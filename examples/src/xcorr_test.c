@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dspl.h"
+
+#define N     1000
+#define DELAY 37
+#define NR    64
+#define NS    4
+#define NRS   100
+int main()
+{
+  void* handle;           // DSPL handle
+  handle = dspl_load();   // Load DSPL function
+  double x[N], y[N], r[2*NR+1], t[2*NR+1], rs[2*NRS+1];
+  random_t rnd;
+  fft_t pfft;
+  int n, err, ind;
+
+  random_init(&rnd, RAND_TYPE_MRG32K3A, NULL);
+  memset(&pfft, 0, sizeof(fft_t));
+
+  // y is a noise, x is y delayed by DELAY samples
+  randn(y, N, 0.0, 1.0, &rnd);
+  memset(x, 0, sizeof(x));
+  memcpy(x + DELAY, y, (N - DELAY) * sizeof(double));
+
+  err = xcorr(x, N, y, N, DSPL_XCORR_NORMALIZED, NR, &pfft, r, t);
+  printf("xcorr error: 0x%.8x\n", err);
+
+  // time delay estimation
+  ind = 0;
+  for(n = 1; n < 2*NR+1; n++)
+    if(r[n] > r[ind])
+      ind = n;
+  printf("estimated delay: %.0f  (r = %.4f)\n", t[ind], r[ind]);
+
+  // maximal lag is greater than vectors size,
+  // lags without vectors overlap must be zero
+  err = xcorr(x, NS, y, NS, DSPL_XCORR_NOSCALE, NRS, &pfft, rs, NULL);
+  printf("xcorr (nr > nx) error: 0x%.8x\n", err);
+  ind = 0;
+  for(n = 0; n < 2*NRS+1; n++)
+    if(n < NRS - NS + 1 || n > NRS + NS - 1)
+      ind += rs[n] != 0.0;
+  err = autocorr(x, NS, DSPL_XCORR_UNBIASED, NRS, &pfft, rs, NULL);
+  printf("autocorr (nr > nx) error: 0x%.8x\n", err);
+  for(n = 0; n < 2*NRS+1; n++)
+    if(n < NRS - NS + 1 || n > NRS + NS - 1)
+      ind += rs[n] != 0.0;
+  printf("nonzero lags without overlap: %d\n", ind);
+
+  fft_free(&pfft);        // free fft structure memory
+  dspl_free(handle);      // free dspl handle
+  return 0;
+}
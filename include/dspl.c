@@ -38,6 +38,7 @@
 p_acos_cmplx                            acos_cmplx                    ;
 p_array_scale_lin                       array_scale_lin               ;
 p_asin_cmplx                            asin_cmplx                    ;
+p_autocorr                              autocorr                      ;
 
 p_butter_ap                             butter_ap                     ;
 p_bessel_i0                             bessel_i0                     ;
@@ -51,6 +52,11 @@ p_cheby1_ap_zp                          cheby1_ap_zp                  ;
 p_cheby2_ap                             cheby2_ap                     ;
 p_cheby2_ap_wp1                         cheby2_ap_wp1                 ;
 p_cheby2_ap_zp                          cheby2_ap_zp                  ;
+p_cic_comp_fir                          cic_comp_fir                  ;
+p_cic_create                            cic_create                    ;
+p_cic_decim_process                     cic_decim_process             ;
+p_cic_free                              cic_free                      ;
+p_cic_interp_process                    cic_interp_process            ;
 p_cmplx2re                              cmplx2re                      ;
 p_concat                                concat                        ;
 p_conv                                  conv                          ;
@@ -64,6 +70,7 @@ p_decimate_cmplx                        decimate_cmplx                ;
 p_dft                                   dft                           ;
 p_dft_cmplx                             dft_cmplx                     ;
 p_dmod                                  dmod                          ;
+p_dspl_ftz_mode                         dspl_ftz_mode                 ;
 p_dspl_info                             dspl_info                     ;
 
 p_ellip_acd                             ellip_acd                     ;
@@ -79,8 +86,11 @@ p_ellip_modulareq                       ellip_modulareq               ;
 p_ellip_rat                             ellip_rat                     ;
 p_ellip_sn                              ellip_sn                      ;
 p_ellip_sn_cmplx                        ellip_sn_cmplx                ;
+p_farrow_create                         farrow_create                 ;
+p_farrow_free                           farrow_free                   ;
 
 p_farrow_lagrange                       farrow_lagrange               ;
+p_farrow_process                        farrow_process                ;
 p_farrow_spline                         farrow_spline                 ;
 p_fft                                   fft                           ;
 p_fft_cmplx                             fft_cmplx                     ;
@@ -90,12 +100,45 @@ p_fft_mag                               fft_mag                       ;
 p_fft_mag_cmplx                         fft_mag_cmplx                 ;
 p_fft_shift                             fft_shift                     ;
 p_fft_shift_cmplx                       fft_shift_cmplx               ;
+p_filter_cache_enable                   filter_cache_enable           ;
+p_filter_cache_stat                     filter_cache_stat             ;
+p_filter_design                         filter_design                 ;
+p_filter_fir_sym                        filter_fir_sym                ;
 p_filter_freq_resp                      filter_freq_resp              ;
 p_filter_iir                            filter_iir                    ;
+p_filter_iir_bank                       filter_iir_bank               ;
+p_filter_iir_cmplx                      filter_iir_cmplx              ;
+p_filter_iir_cmplx_coeff                filter_iir_cmplx_coeff        ;
+p_filter_iir_create                     filter_iir_create             ;
+p_filter_iir_free                       filter_iir_free               ;
+p_filter_iir_init                       filter_iir_init               ;
+p_filter_iir_mch                        filter_iir_mch                ;
+p_filter_iir_par                        filter_iir_par                ;
+p_filter_iir_process                    filter_iir_process            ;
+p_filter_sos                            filter_sos                    ;
 p_filter_ws1                            filter_ws1                    ;
 p_filter_zp2ab                          filter_zp2ab                  ;
+p_filter_zpk2sos                        filter_zpk2sos                ;
 p_find_max_abs                          find_max_abs                  ;
+p_fir_decim_create                      fir_decim_create              ;
+p_fir_decim_free                        fir_decim_free                ;
+p_fir_decim_process                     fir_decim_process             ;
+p_fir_decim_process_cmplx               fir_decim_process_cmplx       ;
+p_fir_halfband                          fir_halfband                  ;
+p_fir_interp_create                     fir_interp_create             ;
+p_fir_interp_free                       fir_interp_free               ;
+p_fir_interp_process                    fir_interp_process            ;
+p_fir_interp_process_cmplx              fir_interp_process_cmplx      ;
+p_fir_kaiser_ord                        fir_kaiser_ord                ;
 p_fir_linphase                          fir_linphase                  ;
+p_fir_linphase_bank                     fir_linphase_bank             ;
+p_fir_linphase_cache                    fir_linphase_cache            ;
+p_fir_remez                             fir_remez                     ;
+p_fir_remez_ord                         fir_remez_ord                 ;
+p_fir_resample_create                   fir_resample_create           ;
+p_fir_resample_free                     fir_resample_free             ;
+p_fir_resample_process                  fir_resample_process          ;
+p_fir_resample_process_cmplx            fir_resample_process_cmplx    ;
 p_flipip                                flipip                        ;
 p_flipip_cmplx                          flipip_cmplx                  ;
 p_fourier_integral_cmplx                fourier_integral_cmplx        ;
@@ -106,12 +149,19 @@ p_freqs                                 freqs                         ;
 p_freqs_cmplx                           freqs_cmplx                   ;
 p_freqs2time                            freqs2time                    ;
 p_freqz                                 freqz                         ;
+p_freqz_czt                             freqz_czt                     ;
+p_freqz_fft                             freqz_fft                     ;
 
 p_gnuplot_close                         gnuplot_close                 ;
 p_gnuplot_cmd                           gnuplot_cmd                   ;
 p_gnuplot_create                        gnuplot_create                ;
 p_goertzel                              goertzel                      ;
 p_goertzel_cmplx                        goertzel_cmplx                ;
+p_halfband_create                       halfband_create               ;
+p_halfband_decim_process                halfband_decim_process        ;
+p_halfband_free                         halfband_free                 ;
+p_halfband_interp_process               halfband_interp_process       ;
+p_halfband_plan                         halfband_plan                 ;
 
 p_histogram                             histogram                     ;
 p_histogram_norm                        histogram_norm                ;
@@ -119,6 +169,11 @@ p_histogram_norm                        histogram_norm                ;
 p_idft_cmplx                            idft_cmplx                    ;
 p_ifft_cmplx                            ifft_cmplx                    ;
 p_iir                                   iir                           ;
+p_iir_bank                              iir_bank                      ;
+p_iir_cache                             iir_cache                     ;
+p_iir_ord                               iir_ord                       ;
+p_iir_sos                               iir_sos                       ;
+p_iir_zpk                               iir_zpk                       ;
 
 p_linspace                              linspace                      ;
 p_log_cmplx                             log_cmplx                     ;
@@ -142,7 +197,9 @@ p_minmax                                minmax                        ;
 p_ones                                  ones                          ;
 
 p_poly_z2a_cmplx                        poly_z2a_cmplx                ;
+p_poly_z2a_cmplx_fft                    poly_z2a_cmplx_fft            ;
 p_polyroots                             polyroots                     ;
+p_polyroots_batch                       polyroots_batch               ;
 p_polyval                               polyval                       ;
 p_polyval_cmplx                         polyval_cmplx                 ;
 
@@ -153,6 +210,7 @@ p_randn                                 randn                         ;
 p_random_init                           random_init                   ;
 p_randu                                 randu                         ;
 p_ratcompos                             ratcompos                     ;
+p_ratcompos_fft                         ratcompos_fft                 ;
 p_re2cmplx                              re2cmplx                      ;
 p_readbin                               readbin                       ;
 
@@ -180,6 +238,8 @@ p_writetxt_3dline                       writetxt_3dline               ;
 p_writetxt_cmplx_im                     writetxt_cmplx_im             ;
 p_writetxt_cmplx_re                     writetxt_cmplx_re             ;
 p_writetxt_int                          writetxt_int                  ;
+p_xcorr                                 xcorr                         ;
+p_xcorr_cmplx                           xcorr_cmplx                   ;
 
 
 
@@ -240,6 +300,7 @@ void* dspl_load()
   LOAD_FUNC(acos_cmplx);
   LOAD_FUNC(array_scale_lin);
   LOAD_FUNC(asin_cmplx);
+  LOAD_FUNC(autocorr);
 
   LOAD_FUNC(bessel_i0);
   LOAD_FUNC(bilinear);
@@ -253,6 +314,11 @@ void* dspl_load()
   LOAD_FUNC(cheby2_ap);
   LOAD_FUNC(cheby2_ap_wp1);
   LOAD_FUNC(cheby2_ap_zp);
+  LOAD_FUNC(cic_comp_fir);
+  LOAD_FUNC(cic_create);
+  LOAD_FUNC(cic_decim_process);
+  LOAD_FUNC(cic_free);
+  LOAD_FUNC(cic_interp_process);
   LOAD_FUNC(cmplx2re);
   LOAD_FUNC(concat);
   LOAD_FUNC(conv);
@@ -266,6 +332,7 @@ void* dspl_load()
   LOAD_FUNC(dft);
   LOAD_FUNC(dft_cmplx);
   LOAD_FUNC(dmod);
+  LOAD_FUNC(dspl_ftz_mode);
   LOAD_FUNC(dspl_info);
 
   LOAD_FUNC(ellip_acd);
@@ -281,8 +348,11 @@ void* dspl_load()
   LOAD_FUNC(ellip_rat);
   LOAD_FUNC(ellip_sn);
   LOAD_FUNC(ellip_sn_cmplx);
+  LOAD_FUNC(farrow_create);
+  LOAD_FUNC(farrow_free);
 
   LOAD_FUNC(farrow_lagrange);
+  LOAD_FUNC(farrow_process);
   LOAD_FUNC(farrow_spline);
   LOAD_FUNC(fft);
   LOAD_FUNC(fft_cmplx);
@@ -292,12 +362,45 @@ void* dspl_load()
   LOAD_FUNC(fft_mag_cmplx);
   LOAD_FUNC(fft_shift);
   LOAD_FUNC(fft_shift_cmplx);
+  LOAD_FUNC(filter_cache_enable);
+  LOAD_FUNC(filter_cache_stat);
+  LOAD_FUNC(filter_design);
+  LOAD_FUNC(filter_fir_sym);
   LOAD_FUNC(filter_freq_resp);
   LOAD_FUNC(filter_iir);
+  LOAD_FUNC(filter_iir_bank);
+  LOAD_FUNC(filter_iir_cmplx);
+  LOAD_FUNC(filter_iir_cmplx_coeff);
+  LOAD_FUNC(filter_iir_create);
+  LOAD_FUNC(filter_iir_free);
+  LOAD_FUNC(filter_iir_init);
+  LOAD_FUNC(filter_iir_mch);
+  LOAD_FUNC(filter_iir_par);
+  LOAD_FUNC(filter_iir_process);
+  LOAD_FUNC(filter_sos);
   LOAD_FUNC(filter_ws1);
   LOAD_FUNC(filter_zp2ab);
+  LOAD_FUNC(filter_zpk2sos);
   LOAD_FUNC(find_max_abs);
+  LOAD_FUNC(fir_decim_create);
+  LOAD_FUNC(fir_decim_free);
+  LOAD_FUNC(fir_decim_process);
+  LOAD_FUNC(fir_decim_process_cmplx);
+  LOAD_FUNC(fir_halfband);
+  LOAD_FUNC(fir_interp_create);
+  LOAD_FUNC(fir_interp_free);
+  LOAD_FUNC(fir_interp_process);
+  LOAD_FUNC(fir_interp_process_cmplx);
+  LOAD_FUNC(fir_kaiser_ord);
   LOAD_FUNC(fir_linphase);
+  LOAD_FUNC(fir_linphase_bank);
+  LOAD_FUNC(fir_linphase_cache);
+  LOAD_FUNC(fir_remez);
+  LOAD_FUNC(fir_remez_ord);
+  LOAD_FUNC(fir_resample_create);
+  LOAD_FUNC(fir_resample_free);
+  LOAD_FUNC(fir_resample_process);
+  LOAD_FUNC(fir_resample_process_cmplx);
   LOAD_FUNC(flipip);
   LOAD_FUNC(flipip_cmplx);
   LOAD_FUNC(fourier_integral_cmplx);
@@ -308,12 +411,19 @@ void* dspl_load()
   LOAD_FUNC(freqs);
   LOAD_FUNC(freqs_cmplx);
   LOAD_FUNC(freqs2time);
+  LOAD_FUNC(freqz_czt);
+  LOAD_FUNC(freqz_fft);
 
   LOAD_FUNC(gnuplot_close);   
   LOAD_FUNC(gnuplot_cmd);     
   LOAD_FUNC(gnuplot_create);  
   LOAD_FUNC(goertzel);
   LOAD_FUNC(goertzel_cmplx);
+  LOAD_FUNC(halfband_create);
+  LOAD_FUNC(halfband_decim_process);
+  LOAD_FUNC(halfband_free);
+  LOAD_FUNC(halfband_interp_process);
+  LOAD_FUNC(halfband_plan);
 
   LOAD_FUNC(histogram);
   LOAD_FUNC(histogram_norm);
@@ -321,6 +431,11 @@ void* dspl_load()
   LOAD_FUNC(idft_cmplx);
   LOAD_FUNC(ifft_cmplx);
   LOAD_FUNC(iir);
+  LOAD_FUNC(iir_bank);
+  LOAD_FUNC(iir_cache);
+  LOAD_FUNC(iir_ord);
+  LOAD_FUNC(iir_sos);
+  LOAD_FUNC(iir_zpk);
 
   LOAD_FUNC(linspace);
   LOAD_FUNC(log_cmplx);
@@ -344,7 +459,9 @@ void* dspl_load()
   LOAD_FUNC(ones);
 
   LOAD_FUNC(poly_z2a_cmplx);
+  LOAD_FUNC(poly_z2a_cmplx_fft);
   LOAD_FUNC(polyroots);
+  LOAD_FUNC(polyroots_batch);
   LOAD_FUNC(polyval);
   LOAD_FUNC(polyval_cmplx);
 
@@ -355,6 +472,7 @@ void* dspl_load()
   LOAD_FUNC(random_init);
   LOAD_FUNC(randu);
   LOAD_FUNC(ratcompos);
+  LOAD_FUNC(ratcompos_fft);
   LOAD_FUNC(re2cmplx);
   LOAD_FUNC(readbin);
 
@@ -382,6 +500,8 @@ void* dspl_load()
   LOAD_FUNC(writetxt_cmplx_im);
   LOAD_FUNC(writetxt_cmplx_re);
   LOAD_FUNC(writetxt_int);
+  LOAD_FUNC(xcorr);
+  LOAD_FUNC(xcorr_cmplx);
 
   #ifdef WIN_OS
   return (void*)handle;
@@ -73,6 +73,90 @@ typedef struct
 
 
 
+typedef struct
+{
+  double*     b;
+  double*     a;
+  double*     z;
+  int         ord;
+} filter_iir_t;
+
+
+
+typedef struct
+{
+  double*     h;
+  double*     z;
+  int         nh;
+  int         np;
+  int         d;
+  int         r;
+} fir_decim_t;
+
+
+
+typedef struct
+{
+  double*     h;
+  double*     z;
+  int         nh;
+  int         np;
+  int         l;
+} fir_interp_t;
+
+
+
+typedef struct
+{
+  double*     h;
+  double*     z;
+  int         nh;
+  int         np;
+  int         p;
+  int         q;
+  int         r;
+  int         m;
+} fir_resample_t;
+
+
+
+typedef struct
+{
+  double*     z;
+  double      t;
+  double      dt;
+  int         type;
+} farrow_t;
+
+
+
+typedef struct
+{
+  unsigned long long* acc;
+  double      sc;
+  double      g;
+  int         r;
+  int         m;
+  int         nst;
+  int         cnt;
+  int         ind;
+} cic_t;
+
+
+
+#define DSPL_HALFBAND_STAGES_MAX    10
+
+typedef struct
+{
+  double*     g;
+  double*     z;
+  int         ord[DSPL_HALFBAND_STAGES_MAX];
+  int         r[DSPL_HALFBAND_STAGES_MAX];
+  int         nst;
+} halfband_t;
+
+
+
 
 #define RE(x)           (x[0])
 #define IM(x)           (x[1])
@@ -98,15 +182,18 @@ typedef struct
 #define ERROR_ARG_PARAM                       0x01180716
 /* B                                          0x02xxxxxx*/
 /* C                                          0x03xxxxxx*/
+#define ERROR_CIC_BITS                        0x03090302
 /* D                                          0x04xxxxxx*/
 #define ERROR_DAT_TYPE                        0x04012020
 #define ERROR_DIV_ZERO                        0x04102226
 /* E                                          0x05xxxxxx*/
 #define ERROR_ELLIP_MODULE                    0x05121315
 /* F                                          0x06xxxxxx*/
+#define ERROR_FARROW_TYPE                     0x06012025
 #define ERROR_FFT_SIZE                        0x06062021
 #define ERROR_FILTER_A0                       0x06090100
 #define ERROR_FILTER_APPROX                   0x06090116
+#define ERROR_FILTER_CACHE                    0x06090301
 #define ERROR_FILTER_FT                       0x06090620
 #define ERROR_FILTER_ORD                      0x06091518
 #define ERROR_FILTER_ORD_BP                   0x06091519
@@ -115,6 +202,7 @@ typedef struct
 #define ERROR_FILTER_TYPE                     0x06092025
 #define ERROR_FILTER_WP                       0x06092316
 #define ERROR_FILTER_WS                       0x06092319
+#define ERROR_FIR_SYM                         0x06091925
 #define ERROR_FNAME                           0x06140113
 #define ERROR_FOPEN                           0x06151605
 #define ERROR_FREAD_SIZE                      0x06180501
@@ -132,6 +220,7 @@ typedef struct
 /* M                                          0x13xxxxxx*/
 #define ERROR_MALLOC                          0x13011212
 #define ERROR_MATRIX_SIZE                     0x13011926
+#define ERROR_MCH_FLAG                        0x13030806
 #define ERROR_MIN_MAX                         0x13091413
 /* N                                          0x14xxxxxx*/
 #define ERROR_NEGATIVE                        0x14050701
@@ -144,10 +233,12 @@ typedef struct
 /* R                                          0x18xxxxxx*/
 #define ERROR_RAND_SIGMA                      0x18011909
 #define ERROR_RAND_TYPE                       0x18012009
+#define ERROR_REMEZ                           0x18051305
 #define ERROR_RESAMPLE_RATIO                  0x18051801
 #define ERROR_RESAMPLE_FRAC_DELAY             0x18050604
 /* S                                          0x19xxxxxx*/
 #define ERROR_SIZE                            0x19092605
+#define ERROR_SOS_ROOTS                       0x19151918
 #define ERROR_SYM_TYPE                        0x19251320
 /* T                                          0x20xxxxxx*/
 /* U                                          0x21xxxxxx*/
@@ -158,6 +249,7 @@ typedef struct
 #define ERROR_WIN_SYM                         0x23091925
 #define ERROR_WIN_TYPE                        0x23092025
 /* X                                          0x24xxxxxx*/
+#define ERROR_XCORR_FLAG                      0x24031518
 /* Y                                          0x25xxxxxx*/
 /* Z                                          0x26xxxxxx*/
 
@@ -214,6 +306,36 @@ typedef struct
 #define DSPL_FILTER_CHEBY1                    0x00000200
 #define DSPL_FILTER_CHEBY2                    0x00000400
 #define DSPL_FILTER_ELLIP                     0x00000800
+#define DSPL_FILTER_FIR_KAISER                0x00001000
+#define DSPL_FILTER_FIR_REMEZ                 0x00002000
+
+
+#define DSPL_XCORR_NOSCALE                    0x00000000
+#define DSPL_XCORR_BIASED                     0x00000001
+#define DSPL_XCORR_UNBIASED                   0x00000002
+#define DSPL_XCORR_NORMALIZED                 0x00000003
+
+
+#define DSPL_MCH_INTERLEAVED                  0x00000000
+#define DSPL_MCH_PLANAR                       0x00000001
+
+
+#define DSPL_FTZ_OFF                          0x00000000
+#define DSPL_FTZ_ON                           0x00000001
+
+
+#define DSPL_FARROW_LAGRANGE                  0x00000000
+#define DSPL_FARROW_SPLINE                    0x00000001
+
+
+#define DSPL_ROOTS_COLD                       0x00000000
+#define DSPL_ROOTS_WARM                       0x00000001
+
+
+#define DSPL_FIR_AUTO                         0x00000000
+#define DSPL_FIR_SYMMETRIC                    0x00000001
+#define DSPL_FIR_ANTISYMMETRIC                0x00000002
+#define DSPL_FIR_GENERIC                      0x00000003
 
 
 
@@ -277,6 +399,14 @@ DECLARE_FUNC(int,        asin_cmplx,                  complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        autocorr,                    double*           x
+                                                COMMA int               nx
+                                                COMMA int               flag
+                                                COMMA int               nr
+                                                COMMA fft_t*            pfft
+                                                COMMA double*           r
+                                                COMMA double*           t);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        bessel_i0,                   double*       x
                                                 COMMA int           n
                                                 COMMA double*       y);
@@ -339,6 +469,33 @@ DECLARE_FUNC(int,        cheby2_ap_zp,                int
                                                 COMMA complex_t*
                                                 COMMA int*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        cic_comp_fir,                int              r
+                                                COMMA int              m
+                                                COMMA int              nst
+                                                COMMA int              ord
+                                                COMMA double           wp
+                                                COMMA int              win_type
+                                                COMMA double           win_param
+                                                COMMA double*          h);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        cic_create,                  cic_t*           pc
+                                                COMMA int              r
+                                                COMMA int              m
+                                                COMMA int              nst);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        cic_decim_process,           cic_t*           pc
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       cic_free,                    cic_t*           pc);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        cic_interp_process,          cic_t*           pc
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        cmplx2re,                    complex_t*
                                                 COMMA int
                                                 COMMA double*
@@ -405,6 +562,8 @@ DECLARE_FUNC(int,        dft_cmplx,                   complex_t*
 DECLARE_FUNC(double,     dmod,                        double
                                                 COMMA double);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        dspl_ftz_mode,               int              mode);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(void,       dspl_info,                   void);
 /*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        ellip_acd,                   double*           w
@@ -476,6 +635,14 @@ DECLARE_FUNC(int,        ellip_sn_cmplx,              complex_t*        u
                                                 COMMA double            k
                                                 COMMA complex_t*        y);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        farrow_create,               farrow_t*        pf
+                                                COMMA double           p
+                                                COMMA double           q
+                                                COMMA double           frd
+                                                COMMA int              type);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       farrow_free,                 farrow_t*        pf);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        farrow_lagrange,             double*
                                                 COMMA int
                                                 COMMA double
@@ -484,6 +651,14 @@ DECLARE_FUNC(int,        farrow_lagrange,             double*
                                                 COMMA double**
                                                 COMMA int*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        farrow_process,              farrow_t*        pf
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double           p
+                                                COMMA double           q
+                                                COMMA double*          y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        farrow_spline,               double*
                                                 COMMA int
                                                 COMMA double
@@ -531,6 +706,29 @@ DECLARE_FUNC(int,        fft_shift_cmplx,             complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_cache_enable,         int              nmax);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_cache_stat,           long long*       hit
+                                                COMMA long long*       miss
+                                                COMMA int*             cnt);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_design,               double           rp
+                                                COMMA double           rs
+                                                COMMA double*          wp
+                                                COMMA double*          ws
+                                                COMMA int              type
+                                                COMMA int*             ord
+                                                COMMA double**         b
+                                                COMMA double**         a);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_fir_sym,              double*          h
+                                                COMMA int              nh
+                                                COMMA int              sym
+                                                COMMA double*          z
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        filter_freq_resp,            double*          b
                                                 COMMA double*          a
                                                 COMMA int              ord
@@ -548,6 +746,70 @@ DECLARE_FUNC(int,        filter_iir,                  double*
                                                 COMMA int
                                                 COMMA double*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_bank,             double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA double*          z
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA int              nch
+                                                COMMA int              flag
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_cmplx,            double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA complex_t*       x
+                                                COMMA int              n
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_cmplx_coeff,      complex_t*       b
+                                                COMMA complex_t*       a
+                                                COMMA int              ord
+                                                COMMA complex_t*       x
+                                                COMMA int              n
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_create,           filter_iir_t*    pf
+                                                COMMA double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       filter_iir_free,             filter_iir_t*    pf);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_init,             filter_iir_t*    pf
+                                                COMMA double           x0);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_mch,              double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA double*          z
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA int              nch
+                                                COMMA int              flag
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_par,              double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA double*          z
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_iir_process,          filter_iir_t*    pf
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_sos,                  double*          sos
+                                                COMMA int              nsec
+                                                COMMA double*          z
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(double,     filter_ws1,                  int              ord
                                                 COMMA double           rp
                                                 COMMA double           rs
@@ -561,11 +823,65 @@ DECLARE_FUNC(int,        filter_zp2ab,                complex_t*
                                                 COMMA double*
                                                 COMMA double*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        filter_zpk2sos,              complex_t*       z
+                                                COMMA complex_t*       p
+                                                COMMA int              ord
+                                                COMMA double           k
+                                                COMMA double*          sos);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        find_max_abs,                double*        a
                                                 COMMA int            n
                                                 COMMA double*        m
                                                 COMMA int*          ind);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_decim_create,            fir_decim_t*     pd
+                                                COMMA double*          h
+                                                COMMA int              nh
+                                                COMMA int              d);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fir_decim_free,              fir_decim_t*     pd);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_decim_process,           fir_decim_t*     pd
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_decim_process_cmplx,     fir_decim_t*     pd
+                                                COMMA complex_t*       x
+                                                COMMA int              n
+                                                COMMA complex_t*       y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_halfband,                int              ord
+                                                COMMA int              win_type
+                                                COMMA double           win_param
+                                                COMMA double*          h);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_interp_create,           fir_interp_t*    pi
+                                                COMMA double*          h
+                                                COMMA int              nh
+                                                COMMA int              l);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fir_interp_free,             fir_interp_t*    pi);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_interp_process,          fir_interp_t*    pi
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_interp_process_cmplx,    fir_interp_t*    pi
+                                                COMMA complex_t*       x
+                                                COMMA int              n
+                                                COMMA complex_t*       y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_kaiser_ord,              double           rp
+                                                COMMA double           rs
+                                                COMMA double           wp
+                                                COMMA double           ws
+                                                COMMA int*             ord
+                                                COMMA double*          beta);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        fir_linphase,                int            ord
                                                 COMMA double         w0
                                                 COMMA double         w1
@@ -574,6 +890,58 @@ DECLARE_FUNC(int,        fir_linphase,                int            ord
                                                 COMMA double         winparam
                                                 COMMA double*        h);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_linphase_bank,           int              ord
+                                                COMMA double*          w0
+                                                COMMA double*          w1
+                                                COMMA int              nch
+                                                COMMA int              filter_type
+                                                COMMA int              win_type
+                                                COMMA double           win_param
+                                                COMMA double*          h);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_linphase_cache,          int              ord
+                                                COMMA double           w0
+                                                COMMA double           w1
+                                                COMMA int              filter_type
+                                                COMMA int              win_type
+                                                COMMA double           win_param
+                                                COMMA const double**   h);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_remez,                   int              ord
+                                                COMMA double*          bands
+                                                COMMA double*          des
+                                                COMMA double*          wt
+                                                COMMA int              nb
+                                                COMMA int              type
+                                                COMMA double*          h);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_remez_ord,               double           rp
+                                                COMMA double           rs
+                                                COMMA double           wp
+                                                COMMA double           ws
+                                                COMMA int*             ord
+                                                COMMA double*          wt);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_resample_create,         fir_resample_t*  pr
+                                                COMMA int              p
+                                                COMMA int              q
+                                                COMMA double*          h
+                                                COMMA int              nh);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       fir_resample_free,           fir_resample_t*  pr);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_resample_process,        fir_resample_t*  pr
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        fir_resample_process_cmplx,  fir_resample_t*  pr
+                                                COMMA complex_t*       x
+                                                COMMA int              n
+                                                COMMA complex_t*       y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        flipip,                      double*
                                                 COMMA int);
 /*----------------------------------------------------------------------------*/
@@ -640,6 +1008,22 @@ DECLARE_FUNC(int,        freqz,                       double*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        freqz_czt,                   double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA double           w0
+                                                COMMA double           dw
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       h);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        freqz_fft,                   double*          b
+                                                COMMA double*          a
+                                                COMMA int              ord
+                                                COMMA int              n
+                                                COMMA fft_t*           pfft
+                                                COMMA complex_t*       h);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(void,       gnuplot_close,               void*             h);
 /*----------------------------------------------------------------------------*/
 DECLARE_FUNC(void,       gnuplot_cmd,                 void*             h
@@ -664,6 +1048,30 @@ DECLARE_FUNC(int,        goertzel_cmplx,              complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        halfband_create,             halfband_t*      ph
+                                                COMMA int              d
+                                                COMMA double           wp
+                                                COMMA double           rs);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        halfband_decim_process,      halfband_t*      ph
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y
+                                                COMMA int*             ny);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(void,       halfband_free,               halfband_t*      ph);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        halfband_interp_process,     halfband_t*      ph
+                                                COMMA double*          x
+                                                COMMA int              n
+                                                COMMA double*          y);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        halfband_plan,               int              d
+                                                COMMA double           wp
+                                                COMMA double           rs
+                                                COMMA int*             ord
+                                                COMMA int*             nst);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        histogram,                   double*          x
                                                 COMMA int              n
                                                 COMMA int              nh
@@ -694,6 +1102,51 @@ DECLARE_FUNC(int,        iir,                         double           rp
                                                 COMMA double*          b
                                                 COMMA double*          a);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_bank,                    double           rp
+                                                COMMA double           rs
+                                                COMMA int              ord
+                                                COMMA double*          w0
+                                                COMMA double*          w1
+                                                COMMA int              nch
+                                                COMMA int              type
+                                                COMMA double*          b
+                                                COMMA double*          a);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_cache,                   double           rp
+                                                COMMA double           rs
+                                                COMMA int              ord
+                                                COMMA double           w0
+                                                COMMA double           w1
+                                                COMMA int              type
+                                                COMMA const double**   b
+                                                COMMA const double**   a);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_ord,                     double           rp
+                                                COMMA double           rs
+                                                COMMA double*          wp
+                                                COMMA double*          ws
+                                                COMMA int              type
+                                                COMMA int*             ord
+                                                COMMA double*          w);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_sos,                     double           rp
+                                                COMMA double           rs
+                                                COMMA int              ord
+                                                COMMA double           w0
+                                                COMMA double           w1
+                                                COMMA int              type
+                                                COMMA double*          sos);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        iir_zpk,                     double           rp
+                                                COMMA double           rs
+                                                COMMA int              ord
+                                                COMMA double           w0
+                                                COMMA double           w1
+                                                COMMA int              type
+                                                COMMA complex_t*       z
+                                                COMMA complex_t*       p
+                                                COMMA double*          k);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        linspace,                    double
                                                 COMMA double
                                                 COMMA int
@@ -805,11 +1258,23 @@ DECLARE_FUNC(int,        poly_z2a_cmplx,              complex_t*
                                                 COMMA int
                                                 COMMA complex_t*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        poly_z2a_cmplx_fft,          complex_t*       z
+                                                COMMA int              nz
+                                                COMMA int              ord
+                                                COMMA complex_t*       a);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        polyroots,                   double*          a
                                                 COMMA int              ord
                                                 COMMA complex_t*       r
                                                 COMMA int*             info);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        polyroots_batch,             double*          a
+                                                COMMA int              ord
+                                                COMMA int              n
+                                                COMMA int              flag
+                                                COMMA complex_t*       r
+                                                COMMA int*             nfb);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        polyval,                     double*
                                                 COMMA int
                                                 COMMA double*
@@ -859,6 +1324,15 @@ DECLARE_FUNC(int,        ratcompos,                   double*          b
                                                 COMMA double*          beta
                                                 COMMA double*          alpha);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        ratcompos_fft,               double*          b
+                                                COMMA double*          a
+                                                COMMA int              n
+                                                COMMA double*          c
+                                                COMMA double*          d
+                                                COMMA int              p
+                                                COMMA double*          beta
+                                                COMMA double*          alpha);
+/*----------------------------------------------------------------------------*/
 DECLARE_FUNC(int,        re2cmplx,                    double*
                                                 COMMA int
                                                 COMMA complex_t*);
@@ -975,6 +1449,26 @@ DECLARE_FUNC(int,        writetxt_int,                int*
                                                 COMMA int
                                                 COMMA char*);
 /*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        xcorr,                       double*           x
+                                                COMMA int               nx
+                                                COMMA double*           y
+                                                COMMA int               ny
+                                                COMMA int               flag
+                                                COMMA int               nr
+                                                COMMA fft_t*            pfft
+                                                COMMA double*           r
+                                                COMMA double*           t);
+/*----------------------------------------------------------------------------*/
+DECLARE_FUNC(int,        xcorr_cmplx,                 complex_t*        x
+                                                COMMA int               nx
+                                                COMMA complex_t*        y
+                                                COMMA int               ny
+                                                COMMA int               flag
+                                                COMMA int               nr
+                                                COMMA fft_t*            pfft
+                                                COMMA complex_t*        r
+                                                COMMA double*           t);
+/*----------------------------------------------------------------------------*/
 
 
 #ifdef __cplusplus